@@ -21,12 +21,12 @@
 
 #define IRQ_M_SOFT 3
 
-#define MSTATUS_MIE 0x00000008
 #define MIP_MSIP (1 << IRQ_M_SOFT)
 
+// The global interrupt enable stays off: the software interrupt only wakes the core
+// from wfi and is cleared by the bootrom, see snitch_bootrom.S
 void cluster_startup() {
     set_csr(mie, MIP_MSIP);
-    set_csr(mstatus, MSTATUS_MIE); // set M global interrupt enable
     return;
 }
 
@@ -25,9 +25,11 @@ module chimera_clu_domain
   parameter type          wide_out_resp_t   = logic
 ) (
   input  logic                                                              soc_clk_i,
+  input  logic                                                              soc_rst_ni,
   input  logic             [                               ExtClusters-1:0] clu_clk_i,
   input  logic             [                               ExtClusters-1:0] rst_ni,
   input  logic             [                               ExtClusters-1:0] widemem_bypass_i,
+  input  logic             [                               ExtClusters-1:0] coalesce_flush_i,
   input  logic             [                                          31:0] boot_addr_i,
   //-----------------------------
   // Interrupt ports
@@ -41,6 +43,8 @@ module chimera_clu_domain
   //-----------------------------
   input  narrow_in_req_t   [                               ExtClusters-1:0] narrow_in_req_i,
   output narrow_in_resp_t  [                               ExtClusters-1:0] narrow_in_resp_o,
+  input  narrow_in_req_t                                                    mcast_req_i,
+  output narrow_in_resp_t                                                   mcast_resp_o,
   output narrow_out_req_t  [              iomsb(Cfg.ChsCfg.AxiExtNumMst):0] narrow_out_req_o,
   input  narrow_out_resp_t [              iomsb(Cfg.ChsCfg.AxiExtNumMst):0] narrow_out_resp_i,
   //-----------------------------
@@ -62,6 +66,42 @@ module chimera_clu_domain
       cheshire_pkg::gen_axi_in(Cfg.ChsCfg).num_in
   );
 
+  `include "axi/typedef.svh"
+
+  typedef logic [Cfg.ChsCfg.AddrWidth-1:0] axi_mcast_addr_t;
+  typedef logic [AxiSlvIdWidth-1:0] axi_mcast_id_t;
+  typedef logic [Cfg.ChsCfg.AxiDataWidth-1:0] axi_mcast_data_t;
+  typedef logic [Cfg.ChsCfg.AxiDataWidth/8-1:0] axi_mcast_strb_t;
+  typedef logic [Cfg.ChsCfg.AxiUserWidth-1:0] axi_mcast_user_t;
+
+  `AXI_TYPEDEF_ALL(axi_mcast, axi_mcast_addr_t, axi_mcast_id_t, axi_mcast_data_t, axi_mcast_strb_t,
+                   axi_mcast_user_t)
+
+  // Cluster narrow inputs with multicast writes merged in
+  narrow_in_req_t   [ExtClusters-1:0] narrow_in_mcast_req;
+  narrow_in_resp_t  [ExtClusters-1:0] narrow_in_mcast_resp;
+
+  chimera_multicast #(
+    .NumClusters       (ExtClusters),
+    .AddrWidth         (Cfg.ChsCfg.AddrWidth),
+    .ClusterRegionStart(ClusterRegionStart),
+    .ClusterAddrBits   (ClusterAddrBits),
+    .aw_chan_t         (axi_mcast_aw_chan_t),
+    .b_chan_t          (axi_mcast_b_chan_t),
+    .r_chan_t          (axi_mcast_r_chan_t),
+    .axi_req_t         (narrow_in_req_t),
+    .axi_resp_t        (narrow_in_resp_t)
+  ) i_cluster_multicast (
+    .clk_i       (soc_clk_i),
+    .rst_ni      (soc_rst_ni),
+    .mcast_req_i (mcast_req_i),
+    .mcast_resp_o(mcast_resp_o),
+    .slv_req_i   (narrow_in_req_i),
+    .slv_resp_o  (narrow_in_resp_o),
+    .mst_req_o   (narrow_in_mcast_req),
+    .mst_resp_i  (narrow_in_mcast_resp)
+  );
+
   // Isolated AXI signals
   narrow_in_req_t   [    iomsb(Cfg.ChsCfg.AxiExtNumSlv):0] narrow_in_isolated_req;
   narrow_in_resp_t  [    iomsb(Cfg.ChsCfg.AxiExtNumSlv):0] narrow_in_isolated_resp;
@@ -93,8 +133,8 @@ module chimera_clu_domain
       ) i_iso_narrow_in_cluster (
         .clk_i     (soc_clk_i),
         .rst_ni    (rst_ni[extClusterIdx]),
-        .slv_req_i (narrow_in_req_i[extClusterIdx]),
-        .slv_resp_o(narrow_in_resp_o[extClusterIdx]),
+        .slv_req_i (narrow_in_mcast_req[extClusterIdx]),
+        .slv_resp_o(narrow_in_mcast_resp[extClusterIdx]),
         .mst_req_o (narrow_in_isolated_req[extClusterIdx]),
         .mst_resp_i(narrow_in_isolated_resp[extClusterIdx]),
         .isolate_i (isolate_i[extClusterIdx]),
@@ -158,8 +198,8 @@ module chimera_clu_domain
 
     end else begin : gen_no_cluster_iso  // bypass isolate if not required
 
-      assign narrow_in_isolated_req[extClusterIdx] = narrow_in_req_i[extClusterIdx];
-      assign narrow_in_resp_o[extClusterIdx] = narrow_in_isolated_resp[extClusterIdx];
+      assign narrow_in_isolated_req[extClusterIdx] = narrow_in_mcast_req[extClusterIdx];
+      assign narrow_in_mcast_resp[extClusterIdx] = narrow_in_isolated_resp[extClusterIdx];
 
       assign narrow_out_req_o[2*extClusterIdx] = narrow_out_isolated_req[2*extClusterIdx];
       assign narrow_out_isolated_resp[2*extClusterIdx] = narrow_out_resp_i[2*extClusterIdx];
@@ -189,6 +229,7 @@ module chimera_clu_domain
         .clu_clk_i(clu_clk_i[extClusterIdx]),
         .rst_ni(rst_ni[extClusterIdx]),
         .widemem_bypass_i(widemem_bypass_i[extClusterIdx]),
+        .coalesce_flush_i(coalesce_flush_i[extClusterIdx]),
         .debug_req_i(debug_req_i[`PREVNRCORES(extClusterIdx)+:`NRCORES(extClusterIdx)]),
         .meip_i(xeip_i[`PREVNRCORES(extClusterIdx)+:`NRCORES(extClusterIdx)]),
         .mtip_i(mtip_i[`PREVNRCORES(extClusterIdx)+:`NRCORES(extClusterIdx)]),
@@ -13,6 +13,18 @@ module chimera_cluster_adapter #(
   parameter int WidePassThroughRegionStart = '0,
   // End address of Memory Island
   parameter int WidePassThroughRegionEnd   = '0,
+  // Log2 depth of the CDC FIFOs between cluster and SoC clock domains
+  parameter int CdcLogDepth                = 3,
+  // Synchronizer stages of the CDC FIFOs between cluster and SoC clock domains
+  parameter int CdcSyncStages              = 3,
+  // Outstanding transactions per ID on the cluster master ID width converters
+  parameter int MaxTxnsPerId               = 4,
+  // Outstanding transactions on the cluster master ID width converters
+  parameter int MaxTxns                    = 4,
+  // Outstanding transactions per ID on the wide-to-narrow bypass
+  parameter int BypassMaxTxnsPerId         = 4,
+  // Outstanding transactions on the wide bypass demux and wide-to-narrow bypass
+  parameter int BypassMaxTxns              = 16,
 
   parameter type narrow_in_req_t   = logic,
   parameter type narrow_in_resp_t  = logic,
@@ -165,7 +177,7 @@ module chimera_cluster_adapter #(
     .axi_req_t  (wide_out_req_t),
     .axi_resp_t (wide_out_resp_t),
     .NoMstPorts (2),
-    .MaxTrans   (16),                    // TODO: Tune this
+    .MaxTrans   (BypassMaxTxns),
     .AxiLookBits(SocWideMasterIdWidth),
     .UniqueIds  (0)
   ) i_wide_demux (
@@ -187,11 +199,11 @@ module chimera_cluster_adapter #(
     .AxiMstPortIdWidth(SocNarrowMasterIdWidth),
 
     .AxiSlvPortMaxUniqIds  (2 ** SocWideMasterIdWidth),
-    .AxiSlvPortMaxTxnsPerId(4),                          // TODO: Tune this
-    .AxiSlvPortMaxTxns     (16),                         // TODO: Tune this
+    .AxiSlvPortMaxTxnsPerId(BypassMaxTxnsPerId),
+    .AxiSlvPortMaxTxns     (BypassMaxTxns),
 
     .AxiMstPortMaxUniqIds  (2 ** SocNarrowMasterIdWidth),
-    .AxiMstPortMaxTxnsPerId(16),                           // TODO: Tune this
+    .AxiMstPortMaxTxnsPerId(BypassMaxTxns),
 
     .AxiAddrWidth(AddrWidth),
     .AxiDataWidth(WideDataWidth),
@@ -280,11 +292,11 @@ module chimera_cluster_adapter #(
     .AxiMstPortIdWidth(SocNarrowMasterIdWidth),
 
     .AxiSlvPortMaxUniqIds  (2 ** ClusterNarrowMasterIdWidth),
-    .AxiSlvPortMaxTxnsPerId(4),                                // TODO: Tune this
-    .AxiSlvPortMaxTxns     (4),                                // TODO: Tune this
+    .AxiSlvPortMaxTxnsPerId(MaxTxnsPerId),
+    .AxiSlvPortMaxTxns     (MaxTxns),
 
     .AxiMstPortMaxUniqIds  (2 ** SocNarrowMasterIdWidth),
-    .AxiMstPortMaxTxnsPerId(4),                            // TODO: Tune this
+    .AxiMstPortMaxTxnsPerId(MaxTxnsPerId),
 
     .AxiAddrWidth(AddrWidth),
     .AxiDataWidth(NarrowDataWidth),
@@ -309,10 +321,10 @@ module chimera_cluster_adapter #(
     .AxiMstPortIdWidth(SocWideMasterIdWidth),
 
     .AxiSlvPortMaxUniqIds  (2 ** ClusterWideMasterIdWidth),
-    .AxiSlvPortMaxTxnsPerId(4),
-    .AxiSlvPortMaxTxns     (4),
+    .AxiSlvPortMaxTxnsPerId(MaxTxnsPerId),
+    .AxiSlvPortMaxTxns     (MaxTxns),
     .AxiMstPortMaxUniqIds  (2 ** SocWideMasterIdWidth),
-    .AxiMstPortMaxTxnsPerId(4),
+    .AxiMstPortMaxTxnsPerId(MaxTxnsPerId),
 
     .AxiAddrWidth(AddrWidth),
     .AxiDataWidth(WideDataWidth),
@@ -333,6 +345,8 @@ module chimera_cluster_adapter #(
   // AXI Narrow CDC from SoC to Cluster
 
   axi_cdc #(
+    .LogDepth  (CdcLogDepth),
+    .SyncStages(CdcSyncStages),
     .aw_chan_t (axi_narrow_soc_in_aw_chan_t),
     .w_chan_t  (axi_narrow_soc_in_w_chan_t),
     .b_chan_t  (axi_narrow_soc_in_b_chan_t),
@@ -355,6 +369,8 @@ module chimera_cluster_adapter #(
   // AXI Narrow CDC from Cluster to SoC
 
   axi_cdc #(
+    .LogDepth  (CdcLogDepth),
+    .SyncStages(CdcSyncStages),
     .aw_chan_t (axi_narrow_soc_out_aw_chan_t),
     .w_chan_t  (axi_narrow_soc_out_w_chan_t),
     .b_chan_t  (axi_narrow_soc_out_b_chan_t),
@@ -377,6 +393,8 @@ module chimera_cluster_adapter #(
   // AXI Wide CDC from Cluster to SoC
 
   axi_cdc #(
+    .LogDepth  (CdcLogDepth),
+    .SyncStages(CdcSyncStages),
     .aw_chan_t (axi_wide_clu_out_aw_chan_t),
     .w_chan_t  (axi_wide_clu_out_w_chan_t),
     .b_chan_t  (axi_wide_clu_out_b_chan_t),
@@ -0,0 +1,287 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Forks writes to the multicast window into the narrow input ports of several clusters.
+//
+// The cluster mask is encoded in the address: bit `ClusterAddrBits + i` selects cluster i,
+// the bits below give the offset within each cluster's address space. A write burst to the
+// window is replayed on every selected cluster port and a single B response, carrying the
+// worst response of all clusters, is returned.
+//
+// Before injecting, the write channels of the selected clusters are drained of regular
+// traffic and locked, so regular and multicast B responses never mix. A regular AW that
+// is already offered to a cluster when draining starts stays valid until accepted and is
+// drained like any other; a port is only locked while no regular AW is offered.
+// Multicast writes are handled one at a time; reads and atomics to the window are not
+// supported and reads return a decode error.
+
+module chimera_multicast #(
+  parameter int unsigned                           NumClusters        = 1,
+  parameter int unsigned                           AddrWidth          = 32,
+  parameter chimera_pkg::doub_bt [NumClusters-1:0] ClusterRegionStart = '0,
+  // Log2 of the address space of each cluster
+  parameter int unsigned                           ClusterAddrBits    = 21,
+
+  parameter type aw_chan_t  = logic,
+  parameter type b_chan_t   = logic,
+  parameter type r_chan_t   = logic,
+  parameter type axi_req_t  = logic,
+  parameter type axi_resp_t = logic
+) (
+  input  logic                        clk_i,
+  input  logic                        rst_ni,
+  // Multicast window
+  input  axi_req_t                    mcast_req_i,
+  output axi_resp_t                   mcast_resp_o,
+  // Regular traffic to each cluster
+  input  axi_req_t  [NumClusters-1:0] slv_req_i,
+  output axi_resp_t [NumClusters-1:0] slv_resp_o,
+  // Cluster narrow input ports
+  output axi_req_t  [NumClusters-1:0] mst_req_o,
+  input  axi_resp_t [NumClusters-1:0] mst_resp_i
+);
+
+  `include "common_cells/registers.svh"
+
+  typedef logic [NumClusters-1:0] mask_t;
+  typedef logic [7:0] cnt_t;
+
+  typedef enum logic [2:0] {
+    McIdle,
+    McDrain,
+    McAw,
+    McW,
+    McB,
+    McResp,
+    McErrW
+  } mc_state_e;
+
+  mc_state_e state_d, state_q;
+  aw_chan_t aw_d, aw_q;
+  mask_t sel_d, sel_q;
+  mask_t lock_d, lock_q;
+  mask_t done_d, done_q;  // Selected ports that completed the current AW, W beat or B
+  axi_pkg::resp_t resp_d, resp_q;
+
+  // Regular writes forwarded to each cluster that have not yet received their B
+  cnt_t [NumClusters-1:0] aw_pend_d, aw_pend_q;
+  // A regular W burst is partially forwarded
+  mask_t w_open_d, w_open_q;
+  // A regular AW is offered to the cluster and not yet accepted
+  mask_t aw_held_d, aw_held_q;
+
+  axi_resp_t mcast_resp_wr, mcast_resp_rd;
+
+  // Read error responder, also answers the R beat of rejected atomics
+  logic rd_active_d, rd_active_q;
+  r_chan_t rd_r_d, rd_r_q;
+  axi_pkg::len_t rd_len_d, rd_len_q;
+  logic atop_r_req;
+
+  mask_t aw_mask;
+  assign aw_mask = mask_t'(mcast_req_i.aw.addr[ClusterAddrBits+:NumClusters]);
+
+  // Worst of two responses: errors dominate, DECERR over SLVERR
+  function automatic axi_pkg::resp_t resp_merge(axi_pkg::resp_t a, axi_pkg::resp_t b);
+    return (a > b) ? a : b;
+  endfunction
+
+  // ----------------
+  // | Write fork   |
+  // ----------------
+
+  always_comb begin
+    state_d   = state_q;
+    aw_d      = aw_q;
+    sel_d     = sel_q;
+    lock_d    = lock_q;
+    done_d    = done_q;
+    resp_d    = resp_q;
+    aw_pend_d = aw_pend_q;
+    w_open_d  = w_open_q;
+    aw_held_d = '0;
+
+    mcast_resp_wr        = '0;
+    mcast_resp_wr.b.id   = aw_q.id;
+    mcast_resp_wr.b.resp = resp_q;
+    atop_r_req           = 1'b0;
+
+    // Regular traffic passes unless the port is draining or locked
+    for (int unsigned c = 0; c < NumClusters; c++) begin
+      mst_req_o[c]  = slv_req_i[c];
+      slv_resp_o[c] = mst_resp_i[c];
+
+      if (lock_q[c]) begin
+        mst_req_o[c].aw_valid  = 1'b0;
+        mst_req_o[c].aw        = aw_q;
+        mst_req_o[c].aw.addr   = ClusterRegionStart[c][AddrWidth-1:0] |
+                                 aw_q.addr[ClusterAddrBits-1:0];
+        mst_req_o[c].w_valid   = 1'b0;
+        mst_req_o[c].w         = mcast_req_i.w;
+        mst_req_o[c].b_ready   = 1'b0;
+        slv_resp_o[c].aw_ready = 1'b0;
+        slv_resp_o[c].w_ready  = 1'b0;
+        slv_resp_o[c].b_valid  = 1'b0;
+      end else begin
+        // Stop new regular AWs, but never withdraw one that is already offered
+        if (state_q == McDrain && sel_q[c] && !aw_held_q[c]) begin
+          mst_req_o[c].aw_valid  = 1'b0;
+          slv_resp_o[c].aw_ready = 1'b0;
+        end
+        aw_held_d[c] = mst_req_o[c].aw_valid && !mst_resp_i[c].aw_ready;
+        if (mst_req_o[c].aw_valid && mst_resp_i[c].aw_ready) aw_pend_d[c] = aw_pend_d[c] + 1;
+        if (mst_resp_i[c].b_valid && slv_req_i[c].b_ready) aw_pend_d[c] = aw_pend_d[c] - 1;
+        if (slv_req_i[c].w_valid && mst_resp_i[c].w_ready) w_open_d[c] = !slv_req_i[c].w.last;
+      end
+    end
+
+    unique case (state_q)
+      McIdle: begin
+        // Atomics returning data need the read responder for their R beats
+        if (mcast_req_i.aw_valid &&
+            !(mcast_req_i.aw.atop[axi_pkg::ATOP_R_RESP] && rd_active_q)) begin
+          mcast_resp_wr.aw_ready = 1'b1;
+          atop_r_req             = mcast_req_i.aw.atop[axi_pkg::ATOP_R_RESP];
+          aw_d                  = mcast_req_i.aw;
+          sel_d                 = aw_mask;
+          resp_d                = axi_pkg::RESP_OKAY;
+          if (aw_mask == '0 || mcast_req_i.aw.atop != '0) begin
+            resp_d  = axi_pkg::RESP_DECERR;
+            state_d = McErrW;
+          end else begin
+            state_d = McDrain;
+          end
+        end
+      end
+
+      McDrain: begin
+        for (int unsigned c = 0; c < NumClusters; c++) begin
+          if (sel_q[c] && !aw_held_q[c] && aw_pend_q[c] == '0 && !w_open_q[c]) lock_d[c] = 1'b1;
+        end
+        if ((lock_q & sel_q) == sel_q) begin
+          done_d  = '0;
+          state_d = McAw;
+        end
+      end
+
+      McAw: begin
+        for (int unsigned c = 0; c < NumClusters; c++) begin
+          if (sel_q[c] && !done_q[c]) begin
+            mst_req_o[c].aw_valid = 1'b1;
+            if (mst_resp_i[c].aw_ready) done_d[c] = 1'b1;
+          end
+        end
+        if ((done_d & sel_q) == sel_q) begin
+          done_d  = '0;
+          state_d = McW;
+        end
+      end
+
+      McW: begin
+        // Each beat is offered to all selected ports and consumed once all took it
+        if (mcast_req_i.w_valid) begin
+          for (int unsigned c = 0; c < NumClusters; c++) begin
+            if (sel_q[c] && !done_q[c]) begin
+              mst_req_o[c].w_valid = 1'b1;
+              if (mst_resp_i[c].w_ready) done_d[c] = 1'b1;
+            end
+          end
+          if ((done_d & sel_q) == sel_q) begin
+            mcast_resp_wr.w_ready = 1'b1;
+            done_d               = '0;
+            if (mcast_req_i.w.last) state_d = McB;
+          end
+        end
+      end
+
+      McB: begin
+        for (int unsigned c = 0; c < NumClusters; c++) begin
+          if (sel_q[c] && !done_q[c]) begin
+            mst_req_o[c].b_ready = 1'b1;
+            if (mst_resp_i[c].b_valid) begin
+              done_d[c] = 1'b1;
+              resp_d    = resp_merge(resp_d, mst_resp_i[c].b.resp);
+            end
+          end
+        end
+        if ((done_d & sel_q) == sel_q) begin
+          lock_d  = '0;
+          state_d = McResp;
+        end
+      end
+
+      McResp: begin
+        mcast_resp_wr.b_valid = 1'b1;
+        if (mcast_req_i.b_ready) state_d = McIdle;
+      end
+
+      McErrW: begin
+        // Swallow the data of an unsupported write
+        mcast_resp_wr.w_ready = 1'b1;
+        if (mcast_req_i.w_valid && mcast_req_i.w.last) state_d = McResp;
+      end
+
+      default: state_d = McIdle;
+    endcase
+  end
+
+  `FF(state_q, state_d, McIdle)
+  `FF(aw_q, aw_d, '0)
+  `FF(sel_q, sel_d, '0)
+  `FF(lock_q, lock_d, '0)
+  `FF(done_q, done_d, '0)
+  `FF(resp_q, resp_d, axi_pkg::RESP_OKAY)
+  `FF(aw_pend_q, aw_pend_d, '0)
+  `FF(w_open_q, w_open_d, '0)
+  `FF(aw_held_q, aw_held_d, '0)
+
+  // ----------------
+  // | Read error   |
+  // ----------------
+
+  always_comb begin
+    rd_active_d = rd_active_q;
+    rd_r_d      = rd_r_q;
+    rd_len_d    = rd_len_q;
+
+    mcast_resp_rd          = '0;
+    mcast_resp_rd.ar_ready = !rd_active_q;
+    mcast_resp_rd.r_valid  = rd_active_q;
+    mcast_resp_rd.r        = rd_r_q;
+    mcast_resp_rd.r.last   = (rd_len_q == '0);
+
+    if (atop_r_req) begin
+      mcast_resp_rd.ar_ready = 1'b0;
+      rd_active_d            = 1'b1;
+      rd_r_d                 = '0;
+      rd_r_d.id              = mcast_req_i.aw.id;
+      rd_r_d.resp            = axi_pkg::RESP_DECERR;
+      rd_len_d               = mcast_req_i.aw.len;
+    end else if (!rd_active_q && mcast_req_i.ar_valid) begin
+      rd_active_d = 1'b1;
+      rd_r_d      = '0;
+      rd_r_d.id   = mcast_req_i.ar.id;
+      rd_r_d.resp = axi_pkg::RESP_DECERR;
+      rd_len_d    = mcast_req_i.ar.len;
+    end else if (rd_active_q && mcast_req_i.r_ready) begin
+      rd_len_d = rd_len_q - 1;
+      if (rd_len_q == '0) rd_active_d = 1'b0;
+    end
+  end
+
+  `FF(rd_active_q, rd_active_d, 1'b0)
+  `FF(rd_r_q, rd_r_d, '0)
+  `FF(rd_len_q, rd_len_d, '0)
+
+  // Write channels from the fork, read channels from the error responder
+  always_comb begin
+    mcast_resp_o          = mcast_resp_wr;
+    mcast_resp_o.ar_ready = mcast_resp_rd.ar_ready;
+    mcast_resp_o.r        = mcast_resp_rd.r;
+    mcast_resp_o.r_valid  = mcast_resp_rd.r_valid;
+  end
+
+endmodule : chimera_multicast
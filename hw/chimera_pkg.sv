@@ -68,6 +68,16 @@ package chimera_pkg;
     byte_bt        MemIslWidePorts;
     byte_bt        MemIslNumWideBanks;
     shrt_bt        MemIslWordsPerBank;
+    aw_bt          CluNarrowAxiMstIdWidth;
+    byte_bt        CluCdcLogDepth;
+    byte_bt        CluCdcSyncStages;
+    byte_bt        CluAxiMaxTxnsPerId;
+    byte_bt        CluAxiMaxTxns;
+    byte_bt        CluBypassMaxTxnsPerId;
+    byte_bt        CluBypassMaxTxns;
+    byte_bt        CluDmaNumAxInFlight;
+    byte_bt        CluDmaReqFifoDepth;
+    bit            CluNarrowCoalesce;
     int unsigned   IsolateClusters;
   } chimera_cfg_t;
 
@@ -143,9 +153,36 @@ ExtClusters
   localparam int unsigned HypNumPhys = 1;
   localparam int unsigned HypNumChips = 2;
 
+  // Cluster multicast window: address bit ClusterAddrBits + i selects cluster i, the bits
+  // below are the offset within each cluster's address space
+  localparam byte_bt MulticastIdx = HyperbusIdx + 1;
+  localparam int unsigned ClusterAddrBits = 21;
+  localparam doub_bt MulticastRegionStart = 64'h4400_0000;
+  localparam doub_bt MulticastRegionEnd = MulticastRegionStart +
+                                          (64'h1 << (ClusterAddrBits + ExtClusters));
+
   localparam int unsigned LogDepth = 3;
   localparam int unsigned SyncStages = 3;
 
+  // Cluster AXI path: CDC FIFOs and ID width converters between cluster and SoC
+  localparam byte_bt CluCdcLogDepth = LogDepth;
+  localparam byte_bt CluCdcSyncStages = SyncStages;
+  localparam byte_bt CluAxiMaxTxnsPerId = 4;
+  localparam byte_bt CluAxiMaxTxns = 4;
+  // Wide cluster requests outside the memory island, rerouted over the narrow SoC port
+  localparam byte_bt CluBypassMaxTxnsPerId = 4;
+  localparam byte_bt CluBypassMaxTxns = 16;
+
+  // Cluster DMA
+  localparam byte_bt CluDmaNumAxInFlight = 3;
+  localparam byte_bt CluDmaReqFifoDepth = 3;
+
+  // Cluster narrow path: merge sequential single-beat accesses to memory into bursts
+  localparam bit CluNarrowCoalesce = 0;
+  localparam int unsigned CluNarrowCoalesceLineBeats = 8;
+  // Stores a Snitch core may have in flight; a merged write burst never grows beyond this
+  localparam int unsigned CluNumIntOutstandingMem = 4;
+
   // -------------------
   // |   Generate Cfg   |
   // --------------------
@@ -154,6 +191,7 @@ ExtClusters
     localparam int AddrWidth = DefaultCfg.AddrWidth;
     localparam int MemoryIsland = 1;
     localparam int Hyperbus = 1;
+    localparam int Multicast = 1;
 
     chimera_cfg_t  chimera_cfg;
     cheshire_cfg_t cfg = DefaultCfg;
@@ -180,12 +218,16 @@ ExtClusters
 
     // SCHEREMO: Two ports for each cluster: one to convert stray wides, one for the original narrow
     cfg.AxiExtNumMst = ExtClusters + $countones(ChimeraClusterCfg.hasWideMasterPort);
-    cfg.AxiExtNumSlv = ExtClusters + MemoryIsland + Hyperbus;
-    cfg.AxiExtNumRules = ExtClusters + MemoryIsland + Hyperbus;
+    cfg.AxiExtNumSlv = ExtClusters + MemoryIsland + Hyperbus + Multicast;
+    cfg.AxiExtNumRules = ExtClusters + MemoryIsland + Hyperbus + Multicast;
 
-    cfg.AxiExtRegionIdx = {HyperbusIdx, MemIslandIdx, ClusterIdx};
-    cfg.AxiExtRegionStart = {HyperbusRegionStart, MemIslRegionStart, ClusterRegionStart};
-    cfg.AxiExtRegionEnd = {HyperbusRegionEnd, MemIslRegionEnd, ClusterRegionEnd};
+    cfg.AxiExtRegionIdx = {MulticastIdx, HyperbusIdx, MemIslandIdx, ClusterIdx};
+    cfg.AxiExtRegionStart = {
+      MulticastRegionStart, HyperbusRegionStart, MemIslRegionStart, ClusterRegionStart
+    };
+    cfg.AxiExtRegionEnd = {
+      MulticastRegionEnd, HyperbusRegionEnd, MemIslRegionEnd, ClusterRegionEnd
+    };
 
     // REG CFG
     cfg.RegExtNumSlv = ExtRegNum;
@@ -216,6 +258,16 @@ ExtClusters
         MemIslWidePorts           : MemIslWidePorts,
         MemIslNumWideBanks        : MemIslNumWideBanks,
         MemIslWordsPerBank        : MemIslWordsPerBank,
+        CluNarrowAxiMstIdWidth    : ClusterNarrowAxiMstIdWidth,
+        CluCdcLogDepth            : CluCdcLogDepth,
+        CluCdcSyncStages          : CluCdcSyncStages,
+        CluAxiMaxTxnsPerId        : CluAxiMaxTxnsPerId,
+        CluAxiMaxTxns             : CluAxiMaxTxns,
+        CluBypassMaxTxnsPerId     : CluBypassMaxTxnsPerId,
+        CluBypassMaxTxns          : CluBypassMaxTxns,
+        CluDmaNumAxInFlight       : CluDmaNumAxInFlight,
+        CluDmaReqFifoDepth        : CluDmaReqFifoDepth,
+        CluNarrowCoalesce         : CluNarrowCoalesce,
         default: '0
     };
 
@@ -231,9 +283,30 @@ ExtClusters
     return chimera_cfg;
   endfunction : gen_chimera_cfg_isolate
 
-  localparam int unsigned NumCfgs = 2;
+  // High-bandwidth configuration: deeper CDC FIFOs, wider IDs and more outstanding
+  // transactions on the cluster paths to cover HyperRAM and contended memory island latency.
+  // Sequential narrow accesses from the cluster cores are merged into bursts.
+  function automatic chimera_cfg_t gen_chimera_cfg_highbw();
+    chimera_cfg_t chimera_cfg;
+    chimera_cfg                        = gen_chimera_cfg();
+    // Override the cluster path depths
+    chimera_cfg.CluNarrowAxiMstIdWidth = 2;
+    chimera_cfg.CluCdcLogDepth         = 5;
+    chimera_cfg.CluAxiMaxTxnsPerId     = 8;
+    chimera_cfg.CluAxiMaxTxns          = 16;
+    chimera_cfg.CluBypassMaxTxnsPerId  = 8;
+    chimera_cfg.CluBypassMaxTxns       = 32;
+    chimera_cfg.CluDmaNumAxInFlight    = 16;
+    chimera_cfg.CluDmaReqFifoDepth     = 8;
+    chimera_cfg.CluNarrowCoalesce      = 1;
+
+    return chimera_cfg;
+  endfunction : gen_chimera_cfg_highbw
+
+  localparam int unsigned NumCfgs = 3;
 
   localparam chimera_cfg_t [NumCfgs-1:0] ChimeraCfg = {
+    gen_chimera_cfg_highbw(),  // 2: High-bandwidth configuration for the cluster paths
     gen_chimera_cfg_isolate(),  // 1: Configuration with Isolation for Power Managemenet
     gen_chimera_cfg()  // 0: Default configuration
   };
@@ -314,6 +314,11 @@ module chimera_top_wrapper
     reg2hw.wide_mem_cluster_0_bypass.q
   };
 
+  // One-cycle pulse per cluster whose bit is set in a write to the flush register
+  logic [ExtClusters-1:0] narrow_coalesce_flush;
+  assign narrow_coalesce_flush = reg2hw.narrow_coalesce_flush.q &
+                                 {ExtClusters{reg2hw.narrow_coalesce_flush.qe}};
+
   logic [ExtClusters-1:0] cluster_clock_gate_en;
   logic [ExtClusters-1:0] clu_clk_gated;
   assign cluster_clock_gate_en = {
@@ -363,9 +368,11 @@ module chimera_top_wrapper
     .wide_out_resp_t  (axi_wide_mst_rsp_t)
   ) i_cluster_domain (
     .soc_clk_i        (soc_clk_i),
+    .soc_rst_ni       (rst_ni),
     .clu_clk_i        (clu_clk_gated),
     .rst_ni           (cluster_rst_n),
     .widemem_bypass_i (wide_mem_bypass_mode),
+    .coalesce_flush_i (narrow_coalesce_flush),
     .boot_addr_i      (reg2hw.snitch_configurable_boot_addr.q),
     .debug_req_i      (dbg_ext_req),
     .xeip_i           (xeip_ext),
@@ -373,6 +380,8 @@ module chimera_top_wrapper
     .msip_i           (msip_ext),
     .narrow_in_req_i  (axi_slv_req[ClusterIdx[0]+:ExtClusters]),
     .narrow_in_resp_o (axi_slv_rsp[ClusterIdx[0]+:ExtClusters]),
+    .mcast_req_i      (axi_slv_req[MulticastIdx]),
+    .mcast_resp_o     (axi_slv_rsp[MulticastIdx]),
     .narrow_out_req_o (axi_mst_req),
     .narrow_out_resp_i(axi_mst_rsp),
     .wide_out_req_o   (axi_wide_mst_req),
@@ -23,6 +23,7 @@ module chimera_cluster
   input  logic                                        clu_clk_i,
   input  logic                                        rst_ni,
   input  logic                                        widemem_bypass_i,
+  input  logic                                        coalesce_flush_i,
   //-----------------------------
   // Interrupt ports
   //-----------------------------
@@ -72,8 +73,8 @@ module chimera_cluster
   typedef logic [WideDataWidth-1:0] axi_cluster_data_wide_t;
   typedef logic [WideDataWidth/8-1:0] axi_cluster_strb_wide_t;
 
-  typedef logic [ClusterNarrowAxiMstIdWidth-1:0] axi_cluster_mst_id_width_narrow_t;
-  typedef logic [ClusterNarrowAxiMstIdWidth-1+2:0] axi_cluster_slv_id_width_narrow_t;
+  typedef logic [Cfg.CluNarrowAxiMstIdWidth-1:0] axi_cluster_mst_id_width_narrow_t;
+  typedef logic [Cfg.CluNarrowAxiMstIdWidth-1+2:0] axi_cluster_slv_id_width_narrow_t;
 
   typedef logic [NarrowMasterIdWidth-1:0] axi_soc_mst_id_width_narrow_t;
   typedef logic [NarrowSlaveIdWidth-1:0] axi_soc_slv_id_width_narrow_t;
@@ -132,11 +133,20 @@ module chimera_cluster
       .clu_narrow_out_resp_t(axi_cluster_out_narrow_socIW_resp_t),
 
       .MstPorts(2),
-      .SlvPorts(1)
+      .SlvPorts(1),
+
+      // Memory island and HyperRAM are the only regions safe to merge accesses to
+      .Coalesce           (Cfg.CluNarrowCoalesce),
+      .CoalesceNumRegions (2),
+      .CoalesceRegionStart({HyperbusRegionStart, Cfg.MemIslRegionStart}),
+      .CoalesceRegionEnd  ({HyperbusRegionEnd, Cfg.MemIslRegionEnd}),
+      .CoalesceLineBeats  (CluNarrowCoalesceLineBeats),
+      .CoalesceMaxWrites  (CluNumIntOutstandingMem)
 
     ) i_cluster_narrow_adapter (
-      .soc_clk_i(soc_clk_i),
+      .soc_clk_i       (soc_clk_i),
       .rst_ni,
+      .coalesce_flush_i(coalesce_flush_i),
 
       // SoC side narrow.
       .narrow_in_req_i  (narrow_in_req_i),
@@ -164,6 +174,12 @@ module chimera_cluster
   chimera_cluster_adapter #(
     .WidePassThroughRegionStart(Cfg.MemIslRegionStart),
     .WidePassThroughRegionEnd  (Cfg.MemIslRegionEnd),
+    .CdcLogDepth               (Cfg.CluCdcLogDepth),
+    .CdcSyncStages             (Cfg.CluCdcSyncStages),
+    .MaxTxnsPerId              (Cfg.CluAxiMaxTxnsPerId),
+    .MaxTxns                   (Cfg.CluAxiMaxTxns),
+    .BypassMaxTxnsPerId        (Cfg.CluBypassMaxTxnsPerId),
+    .BypassMaxTxns             (Cfg.CluBypassMaxTxns),
 
     .narrow_in_req_t  (axi_cluster_in_narrow_socIW_req_t),
     .narrow_in_resp_t (axi_cluster_in_narrow_socIW_resp_t),
@@ -217,13 +233,13 @@ module chimera_cluster
   } sram_cfgs_t;
 
   localparam int unsigned NumIntOutstandingLoads[NrCores] = '{NrCores{32'h1}};
-  localparam int unsigned NumIntOutstandingMem[NrCores] = '{NrCores{32'h4}};
+  localparam int unsigned NumIntOutstandingMem[NrCores] = '{NrCores{CluNumIntOutstandingMem}};
 
   snitch_cluster #(
     .PhysicalAddrWidth(Cfg.ChsCfg.AddrWidth),
     .NarrowDataWidth  (ClusterDataWidth),            // SCHEREMO: Convolve needs this...
     .WideDataWidth    (WideDataWidth),
-    .NarrowIdWidthIn  (ClusterNarrowAxiMstIdWidth),
+    .NarrowIdWidthIn  (Cfg.CluNarrowAxiMstIdWidth),
     .WideIdWidthIn    (WideMasterIdWidth),
     .NarrowUserWidth  (Cfg.ChsCfg.AxiUserWidth),
     .WideUserWidth    (Cfg.ChsCfg.AxiUserWidth),
@@ -237,8 +253,8 @@ module chimera_cluster
     .ClusterPeriphSize(64),
     .NrBanks          (16),
 
-    .DMANumAxInFlight(3),
-    .DMAReqFifoDepth (3),
+    .DMANumAxInFlight(Cfg.CluDmaNumAxInFlight),
+    .DMAReqFifoDepth (Cfg.CluDmaReqFifoDepth),
 
     .ICacheLineWidth('{256}),
     .ICacheLineCount('{16}),
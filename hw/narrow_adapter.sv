@@ -5,19 +5,27 @@
 // Moritz Scherer <scheremo@iis.ee.ethz.ch>
 
 module narrow_adapter #(
-  parameter type narrow_in_req_t       = logic,
-  parameter type narrow_in_resp_t      = logic,
-  parameter type narrow_out_req_t      = logic,
-  parameter type narrow_out_resp_t     = logic,
-  parameter type clu_narrow_in_req_t   = logic,
-  parameter type clu_narrow_in_resp_t  = logic,
-  parameter type clu_narrow_out_req_t  = logic,
-  parameter type clu_narrow_out_resp_t = logic,
-  parameter int  MstPorts              = 2,
-  parameter int  SlvPorts              = 1
+  parameter type                                          narrow_in_req_t       = logic,
+  parameter type                                          narrow_in_resp_t      = logic,
+  parameter type                                          narrow_out_req_t      = logic,
+  parameter type                                          narrow_out_resp_t     = logic,
+  parameter type                                          clu_narrow_in_req_t   = logic,
+  parameter type                                          clu_narrow_in_resp_t  = logic,
+  parameter type                                          clu_narrow_out_req_t  = logic,
+  parameter type                                          clu_narrow_out_resp_t = logic,
+  parameter int                                           MstPorts              = 2,
+  parameter int                                           SlvPorts              = 1,
+  // Merge sequential single-beat cluster accesses to cacheable regions into bursts
+  parameter bit                                           Coalesce              = 0,
+  parameter int                                           CoalesceNumRegions    = 1,
+  parameter chimera_pkg::doub_bt [CoalesceNumRegions-1:0] CoalesceRegionStart   = '0,
+  parameter chimera_pkg::doub_bt [CoalesceNumRegions-1:0] CoalesceRegionEnd     = '0,
+  parameter int                                           CoalesceLineBeats     = 8,
+  parameter int                                           CoalesceMaxWrites     = 4
 ) (
   input logic soc_clk_i,
   input logic rst_ni,
+  input logic coalesce_flush_i,
 
   // From SoC
   input  narrow_in_req_t   [SlvPorts-1:0] narrow_in_req_i,
@@ -68,7 +76,41 @@ module narrow_adapter #(
                    axi_clu_narrow_data_width_t, axi_clu_narrow_strb_width_t, axi_user_width_t)
 
 
+  clu_narrow_out_req_t  [MstPorts-1:0] clu_narrow_out_coal_req;
+  clu_narrow_out_resp_t [MstPorts-1:0] clu_narrow_out_coal_resp;
+
   for (genvar i = 0; i < MstPorts; i++) begin : gen_clu_to_soc_conv
+
+    if (Coalesce) begin : gen_coalescer
+      narrow_coalescer #(
+        .AddrWidth   (AddrWidth),
+        .DataWidth   (CluNarrowDataWidth),
+        .NumRegions  (CoalesceNumRegions),
+        .RegionStart (CoalesceRegionStart),
+        .RegionEnd   (CoalesceRegionEnd),
+        .LineBeats   (CoalesceLineBeats),
+        .MaxWrites   (CoalesceMaxWrites),
+        .aw_chan_t   (axi_narrow_out_clu_aw_chan_t),
+        .w_chan_t    (axi_narrow_out_clu_w_chan_t),
+        .b_chan_t    (axi_narrow_out_clu_b_chan_t),
+        .ar_chan_t   (axi_narrow_out_clu_ar_chan_t),
+        .r_chan_t    (axi_narrow_out_clu_r_chan_t),
+        .axi_req_t   (clu_narrow_out_req_t),
+        .axi_resp_t  (clu_narrow_out_resp_t)
+      ) i_clu_narrow_coalescer (
+        .clk_i     (soc_clk_i),
+        .rst_ni,
+        .flush_i   (coalesce_flush_i),
+        .slv_req_i (clu_narrow_out_req_i[i]),
+        .slv_resp_o(clu_narrow_out_resp_o[i]),
+        .mst_req_o (clu_narrow_out_coal_req[i]),
+        .mst_resp_i(clu_narrow_out_coal_resp[i])
+      );
+    end else begin : gen_no_coalescer
+      assign clu_narrow_out_coal_req[i] = clu_narrow_out_req_i[i];
+      assign clu_narrow_out_resp_o[i]   = clu_narrow_out_coal_resp[i];
+    end
+
     axi_dw_converter #(
       .AxiMaxReads(2),
 
@@ -93,8 +135,8 @@ module narrow_adapter #(
     ) i_clu_to_soc_dw_converter (
       .clk_i     (soc_clk_i),
       .rst_ni,
-      .slv_req_i (clu_narrow_out_req_i[i]),
-      .slv_resp_o(clu_narrow_out_resp_o[i]),
+      .slv_req_i (clu_narrow_out_coal_req[i]),
+      .slv_resp_o(clu_narrow_out_coal_resp[i]),
       .mst_req_o (narrow_out_req_o[i]),
       .mst_resp_i(narrow_out_resp_i[i])
     );
@@ -0,0 +1,497 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Merges sequential single-beat accesses to cacheable regions into bursts.
+//
+// Writes: naturally aligned single-beat writes with the same ID and attributes that
+// follow each other in memory are merged byte-lane-wise into a line buffer and issued
+// as one full-width INCR burst. Their B responses are held until the burst completes,
+// so a fence on the issuing core still waits for the data to reach memory. The buffer
+// is flushed on any other write, on a read to the buffered line, at the end of the line,
+// once `MaxWrites` writes are buffered, on `flush_i` or after `WriteTimeout` cycles
+// without a new write. `MaxWrites` should match the stores a core may have outstanding:
+// a core blocked on the held B responses cannot issue the write that would continue it.
+//
+// Reads: a naturally aligned single-beat read that directly follows the previous one
+// triggers a read-ahead of the rest of its line. Only reads continuing the sequence are
+// served from the buffer, and the buffer is dropped on any write through this port,
+// on `flush_i` or after `ReadTimeout` cycles, so polling loops always observe memory.
+// Writes of other masters are not observed: data they wrote after a read-ahead is only
+// guaranteed to be visible once `flush_i` was raised.
+//
+// Everything else, including all accesses outside the cacheable regions, passes through.
+
+module narrow_coalescer #(
+  parameter int unsigned                          AddrWidth    = 32,
+  parameter int unsigned                          DataWidth    = 64,
+  // Cacheable address regions in which accesses may be merged
+  parameter int unsigned                          NumRegions   = 1,
+  parameter chimera_pkg::doub_bt [NumRegions-1:0] RegionStart  = '0,
+  parameter chimera_pkg::doub_bt [NumRegions-1:0] RegionEnd    = '0,
+  // Beats per line; merged bursts and read-aheads never cross a line
+  parameter int unsigned                          LineBeats    = 8,
+  // Idle cycles before a partially collected write burst is issued
+  parameter int unsigned                          WriteTimeout = 8,
+  // Buffered writes after which the burst is issued
+  parameter int unsigned                          MaxWrites    = 4,
+  // Cycles before unused read-ahead data is dropped
+  parameter int unsigned                          ReadTimeout  = 64,
+
+  parameter type aw_chan_t  = logic,
+  parameter type w_chan_t   = logic,
+  parameter type b_chan_t   = logic,
+  parameter type ar_chan_t  = logic,
+  parameter type r_chan_t   = logic,
+  parameter type axi_req_t  = logic,
+  parameter type axi_resp_t = logic
+) (
+  input  logic      clk_i,
+  input  logic      rst_ni,
+  // Drop read-ahead data and issue buffered writes
+  input  logic      flush_i,
+  input  axi_req_t  slv_req_i,
+  output axi_resp_t slv_resp_o,
+  output axi_req_t  mst_req_o,
+  input  axi_resp_t mst_resp_i
+);
+
+  `include "common_cells/registers.svh"
+
+  localparam int unsigned StrbWidth = DataWidth / 8;
+  localparam int unsigned BeatOffset = $clog2(StrbWidth);
+  localparam int unsigned LineOffset = BeatOffset + $clog2(LineBeats);
+  localparam int unsigned IdxWidth = $clog2(LineBeats);
+  localparam int unsigned BeatCntWidth = $clog2(LineBeats + 1);
+  // At most one merged write per byte of the line
+  localparam int unsigned WrCntWidth = $clog2(LineBeats * StrbWidth + 1);
+  localparam int unsigned TimerWidth = $clog2((WriteTimeout > ReadTimeout ?
+                                               WriteTimeout : ReadTimeout) + 1);
+  // Outstanding passthrough transactions are tracked up to this many
+  localparam int unsigned PassCntWidth = 8;
+
+  typedef logic [AddrWidth-1:0] addr_t;
+  typedef logic [AddrWidth-LineOffset-1:0] line_t;
+  typedef logic [IdxWidth-1:0] idx_t;
+  typedef logic [BeatCntWidth-1:0] beat_cnt_t;
+  typedef logic [WrCntWidth-1:0] wr_cnt_t;
+  typedef logic [TimerWidth-1:0] timer_t;
+  typedef logic [PassCntWidth-1:0] pass_cnt_t;
+
+  function automatic logic is_cacheable(addr_t addr);
+    for (int unsigned i = 0; i < NumRegions; i++) begin
+      if (addr >= RegionStart[i] && addr < RegionEnd[i]) return 1'b1;
+    end
+    return 1'b0;
+  endfunction
+
+  function automatic line_t line_of(addr_t addr);
+    return addr[AddrWidth-1:LineOffset];
+  endfunction
+
+  function automatic idx_t idx_of(addr_t addr);
+    return addr[LineOffset-1:BeatOffset];
+  endfunction
+
+  // Single-beat access of at most bus width, aligned to its size
+  function automatic logic is_mergeable(addr_t addr, axi_pkg::len_t len, axi_pkg::size_t size,
+                                        axi_pkg::burst_t burst, logic lock);
+    return (len == '0) && (size <= axi_pkg::size_t'(BeatOffset)) &&
+           (burst == axi_pkg::BURST_INCR) && !lock &&
+           ((addr & ((addr_t'(1) << size) - 1)) == '0) && is_cacheable(addr);
+  endfunction
+
+  // ----------------
+  // | Write merge  |
+  // ----------------
+
+  typedef enum logic [2:0] {
+    WrIdle,
+    WrCollect,
+    WrFlushAw,
+    WrFlushW,
+    WrFlushB,
+    WrRespB
+  } wr_state_e;
+
+  wr_state_e wr_state_d, wr_state_q;
+  aw_chan_t wr_aw_d, wr_aw_q;  // First merged write, provides ID and attributes
+  w_chan_t [LineBeats-1:0] wr_w_d, wr_w_q;
+  b_chan_t wr_b_d, wr_b_q;
+  addr_t wr_next_d, wr_next_q;  // Address a sequential write would target next
+  beat_cnt_t wr_beats_d, wr_beats_q;
+  beat_cnt_t wr_beat_d, wr_beat_q;
+  wr_cnt_t wr_writes_d, wr_writes_q;
+  wr_cnt_t wr_resp_d, wr_resp_q;
+  timer_t wr_timer_d, wr_timer_q;
+  pass_cnt_t pass_w_d, pass_w_q;  // W beats left of the passthrough burst in flight
+  pass_cnt_t pass_b_d, pass_b_q;  // Passthrough writes awaiting their B
+
+  axi_req_t mst_req_wr, mst_req_rd;
+  axi_resp_t slv_resp_wr, slv_resp_rd;
+
+  logic aw_mergeable, aw_sequential, wr_hazard, wr_flush, aw_accepted;
+  // Atomics returning data answer on the R channel, which the read-ahead must not mistake
+  // for fill data: they are only accepted while no fill is in flight
+  logic aw_atop_r, rd_filling;
+  beat_cnt_t aw_beat;
+
+  assign aw_mergeable = is_mergeable(slv_req_i.aw.addr, slv_req_i.aw.len, slv_req_i.aw.size,
+                                     slv_req_i.aw.burst, slv_req_i.aw.lock) &&
+                        (slv_req_i.aw.atop == '0);
+
+  assign aw_sequential = (slv_req_i.aw.addr == wr_next_q) &&
+                         (line_of(slv_req_i.aw.addr) == line_of(wr_aw_q.addr)) &&
+                         (slv_req_i.aw.id == wr_aw_q.id) &&
+                         (slv_req_i.aw.cache == wr_aw_q.cache) &&
+                         (slv_req_i.aw.prot == wr_aw_q.prot) &&
+                         (slv_req_i.aw.user == wr_aw_q.user);
+
+  // Position of the incoming write within the merged burst
+  assign aw_beat = beat_cnt_t'(idx_of(slv_req_i.aw.addr) - idx_of(wr_aw_q.addr));
+
+  // A read to the buffered line must wait until the merged burst has completed
+  assign wr_hazard = (wr_state_q != WrIdle) && slv_req_i.ar_valid &&
+                     (line_of(slv_req_i.ar.addr) == line_of(wr_aw_q.addr));
+
+  assign wr_flush = (wr_timer_q == timer_t'(WriteTimeout)) || flush_i ||
+                    (wr_writes_q == wr_cnt_t'(MaxWrites)) ||
+                    (line_of(wr_next_q) != line_of(wr_aw_q.addr)) || wr_hazard ||
+                    (slv_req_i.aw_valid && !(aw_mergeable && aw_sequential));
+
+  always_comb begin
+    wr_state_d    = wr_state_q;
+    wr_aw_d       = wr_aw_q;
+    wr_w_d        = wr_w_q;
+    wr_b_d        = wr_b_q;
+    wr_next_d     = wr_next_q;
+    wr_beats_d    = wr_beats_q;
+    wr_beat_d     = wr_beat_q;
+    wr_writes_d   = wr_writes_q;
+    wr_resp_d     = wr_resp_q;
+    wr_timer_d    = wr_timer_q;
+    pass_w_d      = pass_w_q;
+    pass_b_d      = pass_b_q;
+    aw_accepted   = 1'b0;
+    aw_atop_r     = 1'b0;
+
+    mst_req_wr    = '0;
+    mst_req_wr.aw = slv_req_i.aw;
+    mst_req_wr.w  = slv_req_i.w;
+    slv_resp_wr   = '0;
+    slv_resp_wr.b = mst_resp_i.b;
+
+    // Passthrough B responses; never in flight together with a merged burst
+    if (wr_state_q != WrFlushB && wr_state_q != WrRespB) begin
+      slv_resp_wr.b_valid = mst_resp_i.b_valid;
+      mst_req_wr.b_ready  = slv_req_i.b_ready;
+      if (mst_resp_i.b_valid && slv_req_i.b_ready) pass_b_d = pass_b_d - 1;
+    end
+
+    unique case (wr_state_q)
+      WrIdle: begin
+        if (pass_w_q != '0) begin
+          mst_req_wr.w_valid  = slv_req_i.w_valid;
+          slv_resp_wr.w_ready = mst_resp_i.w_ready;
+          if (slv_req_i.w_valid && mst_resp_i.w_ready) pass_w_d = pass_w_q - 1;
+        end else if (slv_req_i.aw_valid) begin
+          if (aw_mergeable && (pass_b_q == '0)) begin
+            // Take address and data together to open a new burst
+            if (slv_req_i.w_valid) begin
+              slv_resp_wr.aw_ready = 1'b1;
+              slv_resp_wr.w_ready  = 1'b1;
+              aw_accepted          = 1'b1;
+              wr_aw_d              = slv_req_i.aw;
+              wr_w_d[0]            = slv_req_i.w;
+              wr_next_d            = slv_req_i.aw.addr + (addr_t'(1) << slv_req_i.aw.size);
+              wr_beats_d           = beat_cnt_t'(1);
+              wr_writes_d          = wr_cnt_t'(1);
+              wr_timer_d           = '0;
+              wr_state_d           = WrCollect;
+            end
+          end else if ((pass_b_q != '1) &&
+                       !(slv_req_i.aw.atop[axi_pkg::ATOP_R_RESP] && rd_filling)) begin
+            mst_req_wr.aw_valid  = 1'b1;
+            slv_resp_wr.aw_ready = mst_resp_i.aw_ready;
+            if (mst_resp_i.aw_ready) begin
+              aw_accepted = 1'b1;
+              aw_atop_r   = slv_req_i.aw.atop[axi_pkg::ATOP_R_RESP];
+              pass_w_d    = pass_cnt_t'(slv_req_i.aw.len) + 1;
+              pass_b_d    = pass_b_d + 1;
+            end
+          end
+        end
+      end
+
+      WrCollect: begin
+        wr_timer_d = wr_timer_q + 1;
+        if (wr_flush) begin
+          wr_state_d = WrFlushAw;
+        end else if (slv_req_i.aw_valid && slv_req_i.w_valid) begin
+          slv_resp_wr.aw_ready = 1'b1;
+          slv_resp_wr.w_ready  = 1'b1;
+          aw_accepted          = 1'b1;
+          // Either open the next beat or fill more lanes of the last one
+          if (aw_beat == wr_beats_q) begin
+            wr_w_d[aw_beat] = slv_req_i.w;
+            wr_beats_d      = wr_beats_q + 1;
+          end else begin
+            for (int unsigned b = 0; b < StrbWidth; b++) begin
+              if (slv_req_i.w.strb[b]) begin
+                wr_w_d[aw_beat].data[8*b+:8] = slv_req_i.w.data[8*b+:8];
+                wr_w_d[aw_beat].strb[b]      = 1'b1;
+              end
+            end
+          end
+          wr_next_d   = slv_req_i.aw.addr + (addr_t'(1) << slv_req_i.aw.size);
+          wr_writes_d = wr_writes_q + 1;
+          wr_timer_d  = '0;
+        end
+      end
+
+      WrFlushAw: begin
+        mst_req_wr.aw       = wr_aw_q;
+        mst_req_wr.aw.addr  = {wr_aw_q.addr[AddrWidth-1:BeatOffset], {BeatOffset{1'b0}}};
+        mst_req_wr.aw.size  = axi_pkg::size_t'(BeatOffset);
+        mst_req_wr.aw.len   = axi_pkg::len_t'(wr_beats_q - 1);
+        mst_req_wr.aw_valid = 1'b1;
+        if (mst_resp_i.aw_ready) begin
+          wr_beat_d  = '0;
+          wr_state_d = WrFlushW;
+        end
+      end
+
+      WrFlushW: begin
+        mst_req_wr.w       = wr_w_q[wr_beat_q];
+        mst_req_wr.w.last  = (wr_beat_q == wr_beats_q - 1);
+        mst_req_wr.w_valid = 1'b1;
+        if (mst_resp_i.w_ready) begin
+          wr_beat_d = wr_beat_q + 1;
+          if (mst_req_wr.w.last) wr_state_d = WrFlushB;
+        end
+      end
+
+      WrFlushB: begin
+        mst_req_wr.b_ready = 1'b1;
+        if (mst_resp_i.b_valid) begin
+          wr_b_d     = mst_resp_i.b;
+          wr_resp_d  = '0;
+          wr_state_d = WrRespB;
+        end
+      end
+
+      WrRespB: begin
+        // One response per merged write, all carrying the burst's status
+        slv_resp_wr.b       = wr_b_q;
+        slv_resp_wr.b_valid = 1'b1;
+        if (slv_req_i.b_ready) begin
+          wr_resp_d = wr_resp_q + 1;
+          if (wr_resp_q == wr_writes_q - 1) wr_state_d = WrIdle;
+        end
+      end
+
+      default: wr_state_d = WrIdle;
+    endcase
+  end
+
+  `FF(wr_state_q, wr_state_d, WrIdle)
+  `FF(wr_aw_q, wr_aw_d, '0)
+  `FF(wr_w_q, wr_w_d, '0)
+  `FF(wr_b_q, wr_b_d, '0)
+  `FF(wr_next_q, wr_next_d, '0)
+  `FF(wr_beats_q, wr_beats_d, '0)
+  `FF(wr_beat_q, wr_beat_d, '0)
+  `FF(wr_writes_q, wr_writes_d, '0)
+  `FF(wr_resp_q, wr_resp_d, '0)
+  `FF(wr_timer_q, wr_timer_d, '0)
+  `FF(pass_w_q, pass_w_d, '0)
+  `FF(pass_b_q, pass_b_d, '0)
+
+  // ----------------
+  // | Read-ahead   |
+  // ----------------
+
+  typedef enum logic [1:0] {
+    RdIdle,
+    RdHit,
+    RdFillFirst,
+    RdFillRest
+  } rd_state_e;
+
+  rd_state_e rd_state_d, rd_state_q;
+  line_t rd_line_d, rd_line_q;
+  r_chan_t [LineBeats-1:0] rd_data_d, rd_data_q;
+  logic [LineBeats-1:0] rd_avail_d, rd_avail_q;
+  r_chan_t rd_hit_d, rd_hit_q;
+  idx_t rd_fill_idx_d, rd_fill_idx_q;
+  logic rd_stale_d, rd_stale_q;
+  addr_t rd_next_d, rd_next_q;  // Address a sequential read would target next
+  logic rd_next_valid_d, rd_next_valid_q;
+  timer_t rd_timer_d, rd_timer_q;
+  pass_cnt_t pass_r_d, pass_r_q;  // Passthrough reads and atomics awaiting their last R
+
+  logic ar_sequential, ar_hit, ar_prefetch;
+
+  assign rd_filling = (rd_state_q == RdFillFirst) || (rd_state_q == RdFillRest);
+
+  assign ar_sequential = is_mergeable(slv_req_i.ar.addr, slv_req_i.ar.len, slv_req_i.ar.size,
+                                      slv_req_i.ar.burst, slv_req_i.ar.lock) &&
+                         rd_next_valid_q && (slv_req_i.ar.addr == rd_next_q);
+
+  assign ar_hit = ar_sequential && (line_of(slv_req_i.ar.addr) == rd_line_q) &&
+                  rd_avail_q[idx_of(slv_req_i.ar.addr)];
+
+  assign ar_prefetch = ar_sequential && !ar_hit &&
+                       !(slv_req_i.aw_valid && slv_req_i.aw.atop[axi_pkg::ATOP_R_RESP]) &&
+                       (idx_of(slv_req_i.ar.addr) != idx_t'(LineBeats - 1));
+
+  always_comb begin
+    rd_state_d      = rd_state_q;
+    rd_line_d       = rd_line_q;
+    rd_data_d       = rd_data_q;
+    rd_avail_d      = rd_avail_q;
+    rd_hit_d        = rd_hit_q;
+    rd_fill_idx_d   = rd_fill_idx_q;
+    rd_stale_d      = rd_stale_q;
+    rd_next_d       = rd_next_q;
+    rd_next_valid_d = rd_next_valid_q;
+    rd_timer_d      = (rd_avail_q != '0) ? rd_timer_q + 1 : '0;
+    pass_r_d        = pass_r_q + pass_cnt_t'(aw_atop_r);
+
+    mst_req_rd      = '0;
+    mst_req_rd.ar   = slv_req_i.ar;
+    slv_resp_rd     = '0;
+    slv_resp_rd.r   = mst_resp_i.r;
+
+    unique case (rd_state_q)
+      RdIdle: begin
+        if (pass_r_q != '0) begin
+          // Passthrough reads in flight: only more passthrough reads may follow
+          slv_resp_rd.r_valid = mst_resp_i.r_valid;
+          mst_req_rd.r_ready  = slv_req_i.r_ready;
+          if (mst_resp_i.r_valid && slv_req_i.r_ready && mst_resp_i.r.last) pass_r_d = pass_r_d - 1;
+          if (slv_req_i.ar_valid && !wr_hazard && !ar_sequential && (pass_r_q != '1)) begin
+            mst_req_rd.ar_valid  = 1'b1;
+            slv_resp_rd.ar_ready = mst_resp_i.ar_ready;
+            if (mst_resp_i.ar_ready) pass_r_d = pass_r_d + 1;
+          end
+        end else if (slv_req_i.ar_valid && !wr_hazard) begin
+          if (ar_hit) begin
+            // Serve from the read-ahead buffer
+            slv_resp_rd.ar_ready = 1'b1;
+            rd_hit_d             = rd_data_q[idx_of(slv_req_i.ar.addr)];
+            rd_hit_d.id          = slv_req_i.ar.id;
+            rd_hit_d.last        = 1'b1;
+            rd_timer_d           = '0;
+            rd_state_d           = RdHit;
+          end else if (ar_prefetch) begin
+            // Fetch the rest of the line; the first beat answers this read
+            mst_req_rd.ar.addr   = {slv_req_i.ar.addr[AddrWidth-1:BeatOffset], {BeatOffset{1'b0}}};
+            mst_req_rd.ar.size   = axi_pkg::size_t'(BeatOffset);
+            mst_req_rd.ar.len    = axi_pkg::len_t'(LineBeats - 1 - idx_of(slv_req_i.ar.addr));
+            mst_req_rd.ar_valid  = 1'b1;
+            slv_resp_rd.ar_ready = mst_resp_i.ar_ready;
+            if (mst_resp_i.ar_ready) begin
+              rd_line_d     = line_of(slv_req_i.ar.addr);
+              rd_avail_d    = '0;
+              rd_fill_idx_d = idx_of(slv_req_i.ar.addr);
+              rd_stale_d    = 1'b0;
+              rd_state_d    = RdFillFirst;
+            end
+          end else begin
+            mst_req_rd.ar_valid  = 1'b1;
+            slv_resp_rd.ar_ready = mst_resp_i.ar_ready;
+            if (mst_resp_i.ar_ready) pass_r_d = pass_r_d + 1;
+          end
+        end
+        // Track the address a sequential stream would read next
+        if (slv_req_i.ar_valid && slv_resp_rd.ar_ready) begin
+          rd_next_d = slv_req_i.ar.addr + (addr_t'(1) << slv_req_i.ar.size);
+          rd_next_valid_d = is_mergeable(slv_req_i.ar.addr, slv_req_i.ar.len, slv_req_i.ar.size,
+                                         slv_req_i.ar.burst, slv_req_i.ar.lock);
+        end
+      end
+
+      RdHit: begin
+        slv_resp_rd.r       = rd_hit_q;
+        slv_resp_rd.r_valid = 1'b1;
+        if (slv_req_i.r_ready) rd_state_d = RdIdle;
+      end
+
+      RdFillFirst: begin
+        slv_resp_rd.r_valid = mst_resp_i.r_valid;
+        slv_resp_rd.r.last  = 1'b1;
+        mst_req_rd.r_ready  = slv_req_i.r_ready;
+        if (mst_resp_i.r_valid && slv_req_i.r_ready) begin
+          rd_data_d[rd_fill_idx_q]  = mst_resp_i.r;
+          rd_avail_d[rd_fill_idx_q] = !rd_stale_q && !aw_accepted &&
+                                      (mst_resp_i.r.resp == axi_pkg::RESP_OKAY);
+          rd_fill_idx_d             = rd_fill_idx_q + 1;
+          rd_state_d                = mst_resp_i.r.last ? RdIdle : RdFillRest;
+        end
+      end
+
+      RdFillRest: begin
+        mst_req_rd.r_ready = 1'b1;
+        if (mst_resp_i.r_valid) begin
+          rd_data_d[rd_fill_idx_q]  = mst_resp_i.r;
+          rd_avail_d[rd_fill_idx_q] = !rd_stale_q && !aw_accepted &&
+                                      (mst_resp_i.r.resp == axi_pkg::RESP_OKAY);
+          rd_fill_idx_d             = rd_fill_idx_q + 1;
+          rd_timer_d                = '0;
+          if (mst_resp_i.r.last) rd_state_d = RdIdle;
+        end
+      end
+
+      default: rd_state_d = RdIdle;
+    endcase
+
+    // Any write may update buffered data; so does the passage of time
+    if (aw_accepted || flush_i || (rd_timer_q == timer_t'(ReadTimeout))) begin
+      rd_avail_d      = '0;
+      rd_next_valid_d = 1'b0;
+      if (rd_state_q != RdIdle) rd_stale_d = 1'b1;
+    end
+  end
+
+  `FF(rd_state_q, rd_state_d, RdIdle)
+  `FF(rd_line_q, rd_line_d, '0)
+  `FF(rd_data_q, rd_data_d, '0)
+  `FF(rd_avail_q, rd_avail_d, '0)
+  `FF(rd_hit_q, rd_hit_d, '0)
+  `FF(rd_fill_idx_q, rd_fill_idx_d, '0)
+  `FF(rd_stale_q, rd_stale_d, 1'b0)
+  `FF(rd_next_q, rd_next_d, '0)
+  `FF(rd_next_valid_q, rd_next_valid_d, 1'b0)
+  `FF(rd_timer_q, rd_timer_d, '0)
+  `FF(pass_r_q, pass_r_d, '0)
+
+  // Write channels from the write merge, read channels from the read-ahead
+  always_comb begin
+    mst_req_o           = mst_req_wr;
+    mst_req_o.ar        = mst_req_rd.ar;
+    mst_req_o.ar_valid  = mst_req_rd.ar_valid;
+    mst_req_o.r_ready   = mst_req_rd.r_ready;
+    slv_resp_o          = slv_resp_wr;
+    slv_resp_o.ar_ready = slv_resp_rd.ar_ready;
+    slv_resp_o.r        = slv_resp_rd.r;
+    slv_resp_o.r_valid  = slv_resp_rd.r_valid;
+  end
+
+  // Validate parameters
+`ifndef VERILATOR
+`ifndef XSIM
+  initial begin : p_assertions
+    assert (LineBeats >= 2 && (LineBeats & (LineBeats - 1)) == 0)
+    else $fatal(1, "LineBeats must be a power of two greater than one");
+    assert ($bits(slv_req_i.w.data) == DataWidth)
+    else $fatal(1, "DataWidth does not match the AXI data width");
+    assert (MaxWrites >= 1 && MaxWrites <= LineBeats * StrbWidth)
+    else $fatal(1, "MaxWrites must be between one and the bytes of a line");
+  end
+`endif
+`endif
+
+endmodule : narrow_coalescer
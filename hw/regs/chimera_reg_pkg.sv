@@ -69,36 +69,45 @@ package chimera_reg_pkg;
 
   typedef struct packed {logic q;} chimera_reg2hw_cluster_4_busy_reg_t;
 
+  typedef struct packed {
+    logic [4:0] q;
+    logic       qe;
+  } chimera_reg2hw_narrow_coalesce_flush_reg_t;
+
+  typedef struct packed {logic [31:0] q;} chimera_reg2hw_snitch_trace_addr_reg_t;
+
   // Register -> HW type
   typedef struct packed {
-    chimera_reg2hw_snitch_boot_addr_reg_t              snitch_boot_addr;               // [275:244]
-    chimera_reg2hw_snitch_configurable_boot_addr_reg_t snitch_configurable_boot_addr;  // [243:212]
-    chimera_reg2hw_snitch_intr_handler_addr_reg_t      snitch_intr_handler_addr;       // [211:180]
-    chimera_reg2hw_snitch_cluster_0_return_reg_t       snitch_cluster_0_return;        // [179:148]
-    chimera_reg2hw_snitch_cluster_1_return_reg_t       snitch_cluster_1_return;        // [147:116]
-    chimera_reg2hw_snitch_cluster_2_return_reg_t       snitch_cluster_2_return;        // [115:84]
-    chimera_reg2hw_snitch_cluster_3_return_reg_t       snitch_cluster_3_return;        // [83:52]
-    chimera_reg2hw_snitch_cluster_4_return_reg_t       snitch_cluster_4_return;        // [51:20]
-    chimera_reg2hw_reset_cluster_0_reg_t               reset_cluster_0;                // [19:19]
-    chimera_reg2hw_reset_cluster_1_reg_t               reset_cluster_1;                // [18:18]
-    chimera_reg2hw_reset_cluster_2_reg_t               reset_cluster_2;                // [17:17]
-    chimera_reg2hw_reset_cluster_3_reg_t               reset_cluster_3;                // [16:16]
-    chimera_reg2hw_reset_cluster_4_reg_t               reset_cluster_4;                // [15:15]
-    chimera_reg2hw_cluster_0_clk_gate_en_reg_t         cluster_0_clk_gate_en;          // [14:14]
-    chimera_reg2hw_cluster_1_clk_gate_en_reg_t         cluster_1_clk_gate_en;          // [13:13]
-    chimera_reg2hw_cluster_2_clk_gate_en_reg_t         cluster_2_clk_gate_en;          // [12:12]
-    chimera_reg2hw_cluster_3_clk_gate_en_reg_t         cluster_3_clk_gate_en;          // [11:11]
-    chimera_reg2hw_cluster_4_clk_gate_en_reg_t         cluster_4_clk_gate_en;          // [10:10]
-    chimera_reg2hw_wide_mem_cluster_0_bypass_reg_t     wide_mem_cluster_0_bypass;      // [9:9]
-    chimera_reg2hw_wide_mem_cluster_1_bypass_reg_t     wide_mem_cluster_1_bypass;      // [8:8]
-    chimera_reg2hw_wide_mem_cluster_2_bypass_reg_t     wide_mem_cluster_2_bypass;      // [7:7]
-    chimera_reg2hw_wide_mem_cluster_3_bypass_reg_t     wide_mem_cluster_3_bypass;      // [6:6]
-    chimera_reg2hw_wide_mem_cluster_4_bypass_reg_t     wide_mem_cluster_4_bypass;      // [5:5]
-    chimera_reg2hw_cluster_0_busy_reg_t                cluster_0_busy;                 // [4:4]
-    chimera_reg2hw_cluster_1_busy_reg_t                cluster_1_busy;                 // [3:3]
-    chimera_reg2hw_cluster_2_busy_reg_t                cluster_2_busy;                 // [2:2]
-    chimera_reg2hw_cluster_3_busy_reg_t                cluster_3_busy;                 // [1:1]
-    chimera_reg2hw_cluster_4_busy_reg_t                cluster_4_busy;                 // [0:0]
+    chimera_reg2hw_snitch_boot_addr_reg_t              snitch_boot_addr;               // [313:282]
+    chimera_reg2hw_snitch_configurable_boot_addr_reg_t snitch_configurable_boot_addr;  // [281:250]
+    chimera_reg2hw_snitch_intr_handler_addr_reg_t      snitch_intr_handler_addr;       // [249:218]
+    chimera_reg2hw_snitch_cluster_0_return_reg_t       snitch_cluster_0_return;        // [217:186]
+    chimera_reg2hw_snitch_cluster_1_return_reg_t       snitch_cluster_1_return;        // [185:154]
+    chimera_reg2hw_snitch_cluster_2_return_reg_t       snitch_cluster_2_return;        // [153:122]
+    chimera_reg2hw_snitch_cluster_3_return_reg_t       snitch_cluster_3_return;        // [121:90]
+    chimera_reg2hw_snitch_cluster_4_return_reg_t       snitch_cluster_4_return;        // [89:58]
+    chimera_reg2hw_reset_cluster_0_reg_t               reset_cluster_0;                // [57:57]
+    chimera_reg2hw_reset_cluster_1_reg_t               reset_cluster_1;                // [56:56]
+    chimera_reg2hw_reset_cluster_2_reg_t               reset_cluster_2;                // [55:55]
+    chimera_reg2hw_reset_cluster_3_reg_t               reset_cluster_3;                // [54:54]
+    chimera_reg2hw_reset_cluster_4_reg_t               reset_cluster_4;                // [53:53]
+    chimera_reg2hw_cluster_0_clk_gate_en_reg_t         cluster_0_clk_gate_en;          // [52:52]
+    chimera_reg2hw_cluster_1_clk_gate_en_reg_t         cluster_1_clk_gate_en;          // [51:51]
+    chimera_reg2hw_cluster_2_clk_gate_en_reg_t         cluster_2_clk_gate_en;          // [50:50]
+    chimera_reg2hw_cluster_3_clk_gate_en_reg_t         cluster_3_clk_gate_en;          // [49:49]
+    chimera_reg2hw_cluster_4_clk_gate_en_reg_t         cluster_4_clk_gate_en;          // [48:48]
+    chimera_reg2hw_wide_mem_cluster_0_bypass_reg_t     wide_mem_cluster_0_bypass;      // [47:47]
+    chimera_reg2hw_wide_mem_cluster_1_bypass_reg_t     wide_mem_cluster_1_bypass;      // [46:46]
+    chimera_reg2hw_wide_mem_cluster_2_bypass_reg_t     wide_mem_cluster_2_bypass;      // [45:45]
+    chimera_reg2hw_wide_mem_cluster_3_bypass_reg_t     wide_mem_cluster_3_bypass;      // [44:44]
+    chimera_reg2hw_wide_mem_cluster_4_bypass_reg_t     wide_mem_cluster_4_bypass;      // [43:43]
+    chimera_reg2hw_cluster_0_busy_reg_t                cluster_0_busy;                 // [42:42]
+    chimera_reg2hw_cluster_1_busy_reg_t                cluster_1_busy;                 // [41:41]
+    chimera_reg2hw_cluster_2_busy_reg_t                cluster_2_busy;                 // [40:40]
+    chimera_reg2hw_cluster_3_busy_reg_t                cluster_3_busy;                 // [39:39]
+    chimera_reg2hw_cluster_4_busy_reg_t                cluster_4_busy;                 // [38:38]
+    chimera_reg2hw_narrow_coalesce_flush_reg_t         narrow_coalesce_flush;          // [37:32]
+    chimera_reg2hw_snitch_trace_addr_reg_t             snitch_trace_addr;              // [31:0]
   } chimera_reg2hw_t;
 
   // Register offsets
@@ -130,6 +139,8 @@ package chimera_reg_pkg;
   parameter logic [BlockAw-1:0] CHIMERA_CLUSTER_2_BUSY_OFFSET = 7'h64;
   parameter logic [BlockAw-1:0] CHIMERA_CLUSTER_3_BUSY_OFFSET = 7'h68;
   parameter logic [BlockAw-1:0] CHIMERA_CLUSTER_4_BUSY_OFFSET = 7'h6c;
+  parameter logic [BlockAw-1:0] CHIMERA_NARROW_COALESCE_FLUSH_OFFSET = 7'h70;
+  parameter logic [BlockAw-1:0] CHIMERA_SNITCH_TRACE_ADDR_OFFSET = 7'h74;
 
   // Register index
   typedef enum int {
@@ -160,11 +171,13 @@ package chimera_reg_pkg;
     CHIMERA_CLUSTER_1_BUSY,
     CHIMERA_CLUSTER_2_BUSY,
     CHIMERA_CLUSTER_3_BUSY,
-    CHIMERA_CLUSTER_4_BUSY
+    CHIMERA_CLUSTER_4_BUSY,
+    CHIMERA_NARROW_COALESCE_FLUSH,
+    CHIMERA_SNITCH_TRACE_ADDR
   } chimera_id_e;
 
   // Register width information to check illegal writes
-  parameter logic [3:0] CHIMERA_PERMIT[28] = '{
+  parameter logic [3:0] CHIMERA_PERMIT[30] = '{
       4'b1111,  // index[ 0] CHIMERA_SNITCH_BOOT_ADDR
       4'b1111,  // index[ 1] CHIMERA_SNITCH_CONFIGURABLE_BOOT_ADDR
       4'b1111,  // index[ 2] CHIMERA_SNITCH_INTR_HANDLER_ADDR
@@ -192,7 +205,9 @@ package chimera_reg_pkg;
       4'b0001,  // index[24] CHIMERA_CLUSTER_1_BUSY
       4'b0001,  // index[25] CHIMERA_CLUSTER_2_BUSY
       4'b0001,  // index[26] CHIMERA_CLUSTER_3_BUSY
-      4'b0001  // index[27] CHIMERA_CLUSTER_4_BUSY
+      4'b0001,  // index[27] CHIMERA_CLUSTER_4_BUSY
+      4'b0001,  // index[28] CHIMERA_NARROW_COALESCE_FLUSH
+      4'b1111  // index[29] CHIMERA_SNITCH_TRACE_ADDR
   };
 
 endpackage
@@ -151,6 +151,11 @@ module chimera_reg_top #(
   logic        cluster_4_busy_qs;
   logic        cluster_4_busy_wd;
   logic        cluster_4_busy_we;
+  logic [4:0]  narrow_coalesce_flush_wd;
+  logic        narrow_coalesce_flush_we;
+  logic [31:0] snitch_trace_addr_qs;
+  logic [31:0] snitch_trace_addr_wd;
+  logic        snitch_trace_addr_we;
 
   // Register instances
   // R[snitch_boot_addr]: V(False)
@@ -909,9 +914,62 @@ module chimera_reg_top #(
   );
 
 
+  // R[narrow_coalesce_flush]: V(False)
 
+  prim_subreg #(
+    .DW      (5),
+    .SWACCESS("WO"),
+    .RESVAL  (5'h0)
+  ) u_narrow_coalesce_flush (
+    .clk_i (clk_i),
+    .rst_ni(rst_ni),
+
+    // from register interface
+    .we(narrow_coalesce_flush_we),
+    .wd(narrow_coalesce_flush_wd),
+
+    // from internal hardware
+    .de(1'b0),
+    .d ('0),
+
+    // to internal hardware
+    .qe(reg2hw.narrow_coalesce_flush.qe),
+    .q (reg2hw.narrow_coalesce_flush.q),
 
-  logic [27:0] addr_hit;
+    .qs()
+  );
+
+
+  // R[snitch_trace_addr]: V(False)
+
+  prim_subreg #(
+    .DW      (32),
+    .SWACCESS("RW"),
+    .RESVAL  (32'h0)
+  ) u_snitch_trace_addr (
+    .clk_i (clk_i),
+    .rst_ni(rst_ni),
+
+    // from register interface
+    .we(snitch_trace_addr_we),
+    .wd(snitch_trace_addr_wd),
+
+    // from internal hardware
+    .de(1'b0),
+    .d ('0),
+
+    // to internal hardware
+    .qe(),
+    .q (reg2hw.snitch_trace_addr.q),
+
+    // to register interface (read)
+    .qs(snitch_trace_addr_qs)
+  );
+
+
+
+
+  logic [29:0] addr_hit;
   always_comb begin
     addr_hit     = '0;
     addr_hit[0]  = (reg_addr == CHIMERA_SNITCH_BOOT_ADDR_OFFSET);
@@ -942,6 +1000,8 @@ module chimera_reg_top #(
     addr_hit[25] = (reg_addr == CHIMERA_CLUSTER_2_BUSY_OFFSET);
     addr_hit[26] = (reg_addr == CHIMERA_CLUSTER_3_BUSY_OFFSET);
     addr_hit[27] = (reg_addr == CHIMERA_CLUSTER_4_BUSY_OFFSET);
+    addr_hit[28] = (reg_addr == CHIMERA_NARROW_COALESCE_FLUSH_OFFSET);
+    addr_hit[29] = (reg_addr == CHIMERA_SNITCH_TRACE_ADDR_OFFSET);
   end
 
   assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0;
@@ -976,7 +1036,9 @@ module chimera_reg_top #(
                (addr_hit[24] & (|(CHIMERA_PERMIT[24] & ~reg_be))) |
                (addr_hit[25] & (|(CHIMERA_PERMIT[25] & ~reg_be))) |
                (addr_hit[26] & (|(CHIMERA_PERMIT[26] & ~reg_be))) |
-               (addr_hit[27] & (|(CHIMERA_PERMIT[27] & ~reg_be)))));
+               (addr_hit[27] & (|(CHIMERA_PERMIT[27] & ~reg_be))) |
+               (addr_hit[28] & (|(CHIMERA_PERMIT[28] & ~reg_be))) |
+               (addr_hit[29] & (|(CHIMERA_PERMIT[29] & ~reg_be)))));
   end
 
   assign snitch_boot_addr_we              = addr_hit[0] & reg_we & !reg_error;
@@ -1062,6 +1124,10 @@ module chimera_reg_top #(
 
   assign cluster_4_busy_we                = addr_hit[27] & reg_we & !reg_error;
   assign cluster_4_busy_wd                = reg_wdata[0];
+  assign narrow_coalesce_flush_we         = addr_hit[28] & reg_we & !reg_error;
+  assign narrow_coalesce_flush_wd         = reg_wdata[4:0];
+  assign snitch_trace_addr_we             = addr_hit[29] & reg_we & !reg_error;
+  assign snitch_trace_addr_wd             = reg_wdata[31:0];
 
   // Read data return
   always_comb begin
@@ -1179,6 +1245,14 @@ module chimera_reg_top #(
         reg_rdata_next[0] = cluster_4_busy_qs;
       end
 
+      addr_hit[28]: begin
+        reg_rdata_next[4:0] = '0;
+      end
+
+      addr_hit[29]: begin
+        reg_rdata_next[31:0] = snitch_trace_addr_qs;
+      end
+
       default: begin
         reg_rdata_next = '1;
       end
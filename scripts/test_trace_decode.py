@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Solderpad Hardware License, Version 0.51, see LICENSE for details.
+# SPDX-License-Identifier: SHL-0.51
+
+# Author: Lorenzo Leone <lleone@iis.ee.ethz.ch>
+"""Unit tests for trace_decode.py: python3 -m unittest discover -s scripts"""
+
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import trace_decode  # noqa: E402
+
+
+def trace_line(ring, hart, event, seq, timestamp, arg):
+    return f"TRACE {ring:x} {hart:x} {event:x} {seq:x} {timestamp:x} {arg:x}\n"
+
+
+def kernel_cycles(lines):
+    records, _ = trace_decode.parse(lines)
+    by_ring = trace_decode.unwrap(records)
+    runs = trace_decode.kernel_runs(by_ring[0])
+    return {start["hart"]: ret["time"] - start["time"] for start, ret in runs}
+
+
+class UnwrapTest(unittest.TestCase):
+
+    def test_interleaved_harts(self):
+        # Hart 2 claims its entry after hart 1 but read mcycle one cycle earlier
+        lines = [
+            trace_line(0, 1, trace_decode.EV_START, 0, 50, 0x100),
+            trace_line(0, 2, trace_decode.EV_START, 1, 49, 0x200),
+            trace_line(0, 2, trace_decode.EV_RETURN, 2, 60, 0),
+            trace_line(0, 1, trace_decode.EV_RETURN, 3, 66, 0),
+        ]
+        self.assertEqual(kernel_cycles(lines), {1: 16, 2: 11})
+
+    def test_wrap(self):
+        lines = [
+            trace_line(0, 1, trace_decode.EV_START, 0, 0xfffffff0, 0x100),
+            trace_line(0, 1, trace_decode.EV_RETURN, 1, 0x10, 0),
+        ]
+        self.assertEqual(kernel_cycles(lines), {1: 0x20})
+
+    def test_interleaved_harts_across_wrap(self):
+        lines = [
+            trace_line(0, 1, trace_decode.EV_START, 0, 0xfffffff8, 0x100),
+            trace_line(0, 2, trace_decode.EV_START, 1, 0x4, 0x200),
+            trace_line(0, 1, trace_decode.EV_RETURN, 2, 0xfffffffc, 0),
+            trace_line(0, 2, trace_decode.EV_RETURN, 3, 0x8, 0),
+        ]
+        self.assertEqual(kernel_cycles(lines), {1: 4, 2: 4})
+
+
+if __name__ == "__main__":
+    unittest.main()
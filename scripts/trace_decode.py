@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Solderpad Hardware License, Version 0.51, see LICENSE for details.
+# SPDX-License-Identifier: SHL-0.51
+
+# Author: Lorenzo Leone <lleone@iis.ee.ethz.ch>
+"""Decode the trace lines printed by traceDump() (sw/lib/trace.c) into a timeline.
+
+Reads a UART log or simulation transcript, picks up all `TRACE` and `TRACE-LOST`
+lines and prints the events per ring together with the kernel runs found between
+start and return events. Optionally writes a Chrome trace (chrome://tracing,
+Perfetto) with one track per ring.
+
+Timestamps are the mcycle counters of the emitting harts. They are unwrapped per
+ring but not synchronized between rings: with --align, each cluster ring is
+shifted so that its first kernel start coincides with the matching host dispatch.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+NUM_CLUSTERS = 5
+TIMESTAMP_WRAP = 1 << 32
+
+EVENTS = {
+    0x0001: "dispatch",
+    0x0002: "start",
+    0x0003: "return",
+    0x0004: "collect",
+}
+EV_DISPATCH = 0x0001
+EV_START = 0x0002
+EV_RETURN = 0x0003
+EV_USER = 0x0100
+
+TRACE_RE = re.compile(r"TRACE((?: [0-9a-fA-F]+){6})\s*$")
+LOST_RE = re.compile(r"TRACE-LOST ([0-9a-fA-F]+) ([0-9a-fA-F]+)\s*$")
+
+
+def ring_name(ring):
+    return "host" if ring == NUM_CLUSTERS else f"cluster{ring}"
+
+
+def event_name(event):
+    if event >= EV_USER:
+        return f"user+{event - EV_USER}"
+    return EVENTS.get(event, f"event{event:#x}")
+
+
+def parse(lines):
+    records = []
+    lost = {}
+    for line in lines:
+        match = LOST_RE.search(line)
+        if match:
+            ring, count = (int(v, 16) for v in match.groups())
+            lost[ring] = lost.get(ring, 0) + count
+            continue
+        match = TRACE_RE.search(line)
+        if match:
+            ring, hart, event, seq, timestamp, arg = (int(v, 16) for v in match.group(1).split())
+            records.append({
+                "ring": ring,
+                "hart": hart,
+                "event": event,
+                "seq": seq,
+                "timestamp": timestamp,
+                "arg": arg
+            })
+    return records, lost
+
+
+def unwrap(records):
+    """Extend the 32-bit timestamps of each ring to a continuous count.
+
+    Harts sharing a ring claim entries in seq order but may read mcycle a few cycles
+    apart, so small backward steps are expected. Each timestamp is taken as the value
+    closest to the previous one: only a step of more than 2^31 cycles counts as a wrap.
+    """
+    by_ring = {}
+    for rec in sorted(records, key=lambda r: (r["ring"], r["seq"])):
+        by_ring.setdefault(rec["ring"], []).append(rec)
+    for ring_records in by_ring.values():
+        time = None
+        for rec in ring_records:
+            if time is None:
+                time = rec["timestamp"]
+            else:
+                delta = (rec["timestamp"] - time) & (TIMESTAMP_WRAP - 1)
+                if delta >= TIMESTAMP_WRAP // 2:
+                    delta -= TIMESTAMP_WRAP
+                time += delta
+            rec["time"] = time
+    return by_ring
+
+
+def align(by_ring):
+    """Shift cluster rings onto the host time base using the first dispatch/start pair"""
+    host = by_ring.get(NUM_CLUSTERS, [])
+    for ring, ring_records in by_ring.items():
+        if ring == NUM_CLUSTERS:
+            continue
+        dispatch = next((r for r in host if r["event"] == EV_DISPATCH and r["arg"] == ring), None)
+        start = next((r for r in ring_records if r["event"] == EV_START), None)
+        if dispatch is None or start is None:
+            continue
+        shift = dispatch["time"] - start["time"]
+        for rec in ring_records:
+            rec["time"] += shift
+
+
+def kernel_runs(ring_records):
+    """Pair start and return events of the same hart into (start, return) records"""
+    runs = []
+    open_runs = {}
+    for rec in ring_records:
+        if rec["event"] == EV_START:
+            open_runs[rec["hart"]] = rec
+        elif rec["event"] == EV_RETURN and rec["hart"] in open_runs:
+            runs.append((open_runs.pop(rec["hart"]), rec))
+    return runs
+
+
+def print_timeline(by_ring, lost, out):
+    for ring in sorted(by_ring):
+        ring_records = by_ring[ring]
+        out.write(f"== {ring_name(ring)}: {len(ring_records)} events")
+        if lost.get(ring):
+            out.write(f", {lost[ring]} lost")
+        out.write(" ==\n")
+        for rec in ring_records:
+            out.write(f"{rec['time']:>14} hart{rec['hart']:<3} {event_name(rec['event']):<10} "
+                      f"{rec['arg']:#010x}\n")
+        for start, ret in kernel_runs(ring_records):
+            out.write(f"   kernel {start['arg']:#010x} on hart{start['hart']}: "
+                      f"{ret['time'] - start['time']} cycles, returned {ret['arg']:#x}\n")
+
+
+def write_chrome(by_ring, path):
+    events = []
+    for ring, ring_records in by_ring.items():
+        for rec in ring_records:
+            events.append({
+                "name": event_name(rec["event"]),
+                "ph": "i",
+                "s": "t",
+                "ts": rec["time"],
+                "pid": ring_name(ring),
+                "tid": rec["hart"],
+                "args": {
+                    "arg": hex(rec["arg"])
+                }
+            })
+        for start, ret in kernel_runs(ring_records):
+            events.append({
+                "name": f"kernel {start['arg']:#x}",
+                "ph": "X",
+                "ts": start["time"],
+                "dur": ret["time"] - start["time"],
+                "pid": ring_name(ring),
+                "tid": start["hart"],
+                "args": {
+                    "ret": hex(ret["arg"])
+                }
+            })
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", nargs="?", help="UART log or transcript, stdin if omitted")
+    parser.add_argument("--align",
+                        action="store_true",
+                        help="align cluster rings to the host dispatch events")
+    parser.add_argument("--chrome", metavar="JSON", help="also write a Chrome trace file")
+    args = parser.parse_args()
+
+    if args.log:
+        with open(args.log, encoding="utf-8", errors="replace") as f:
+            records, lost = parse(f)
+    else:
+        records, lost = parse(sys.stdin)
+
+    by_ring = unwrap(records)
+    if args.align:
+        align(by_ring)
+
+    print_timeline(by_ring, lost, sys.stdout)
+    if args.chrome:
+        write_chrome(by_ring, args.chrome)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,60 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Bank-aware allocator for buffers shared between the host and the clusters. An
+// arena covers a region of the memory island or HyperRAM and hands out blocks of
+// power-of-two size classes from per-class free lists, so allocation and release
+// are constant time. Blocks are aligned to their size, which covers alignment
+// hints up to the block size.
+//
+// A bank hint places the start of a buffer in a given bank of the backing memory.
+// Buffers streamed concurrently by different clusters should start in different
+// banks so their accesses do not collide. Without a hint, successive allocations
+// rotate over the banks.
+//
+// Neither region is cached by the host, so buffers can be handed to clusters by
+// pointer without copies or cache maintenance. Arenas are not thread-safe and are
+// meant to be managed by the host.
+
+#ifndef _ARENA_INCLUDE_GUARD_
+#define _ARENA_INCLUDE_GUARD_
+
+#include "soc_addr_map.h"
+#include <stdint.h>
+
+#define ARENA_MIN_BLOCK 64 // Multiple of the bank interleaving period
+#define ARENA_NUM_CLASSES 16
+#define ARENA_ANY_BANK 0xff
+// Memory island space left to the stack by arenaInitMemIsland
+#define ARENA_STACK_RESERVE 0x2000
+
+#define ARENA_OK 0
+#define ARENA_ERR_INVALID -1
+
+typedef struct arenaBlock {
+    struct arenaBlock *next;
+} arenaBlock_t;
+
+typedef struct {
+    uintptr_t base;      // First block
+    uintptr_t end;
+    uintptr_t bump;      // Start of the memory never handed out
+    uint8_t *blockClass; // Class + 1 of the block starting at each ARENA_MIN_BLOCK, 0 if free
+    uint32_t numBanks;
+    uint32_t bankWidth;
+    uint32_t nextBank;
+    arenaBlock_t *freeList[ARENA_NUM_CLASSES];
+} arena_t;
+
+int32_t arenaInit(arena_t *arena, void *start, uint32_t size, uint32_t numBanks,
+                  uint32_t bankWidth);
+int32_t arenaInitMemIsland(arena_t *arena);
+int32_t arenaInitHyperRam(arena_t *arena, uint32_t size);
+void *arenaAlloc(arena_t *arena, uint32_t size, uint32_t align, uint8_t bank);
+int32_t arenaFree(arena_t *arena, void *ptr);
+uint32_t arenaBankOf(const arena_t *arena, const void *ptr);
+
+#endif
@@ -0,0 +1,17 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Host console on the Cheshire UART. Tests that report measurements call
+// consoleInit() once and then print with printf from Cheshire's printf.h.
+
+#ifndef _CONSOLE_INCLUDE_GUARD_
+#define _CONSOLE_INCLUDE_GUARD_
+
+#include "printf.h"
+
+void consoleInit();
+
+#endif
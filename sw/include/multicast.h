@@ -0,0 +1,28 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Broadcast of data to several cluster TCDMs through the multicast window. Each
+// write to the window is forked in hardware to all clusters selected by the mask,
+// so broadcasts are issued as bursts by a DMA: the Cheshire DMA from the host, or
+// a cluster DMA targeting MULTICAST_ADDR directly. Reads from the window are not
+// supported.
+//
+// A write to the window only completes once every selected cluster has accepted
+// it. A cluster that is held in reset, clock gated or isolated never does, and
+// the write would stall the window for good: all selected clusters must be active.
+
+#ifndef _MULTICAST_INCLUDE_GUARD_
+#define _MULTICAST_INCLUDE_GUARD_
+
+#include "soc_addr_map.h"
+#include <stdint.h>
+
+#define MULTICAST_OK 0
+#define MULTICAST_ERR_INACTIVE -1
+
+int32_t broadcastToClusters(uint8_t clusterMask, uint32_t offset, const void *src, uint32_t size);
+
+#endif
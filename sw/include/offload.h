@@ -9,16 +9,87 @@
 #ifndef _OFFLOAD_INCLUDE_GUARD_
 #define _OFFLOAD_INCLUDE_GUARD_
 
+#include "regs/soc_ctrl.h"
+#include "soc_addr_map.h"
 #include <stdbool.h>
 #include <stdint.h>
 
 void setupInterruptHandler(void *handler);
-void setClusterClockGating(uint8_t *regPtr, uint8_t clusterId, bool enable);
-void setAllClusterClockGating(uint8_t *regPtr, bool enable);
-void setClusterReset(uint8_t *regPtr, uint8_t clusterId, bool enable);
-void setAllClusterReset(uint8_t *regPtr, bool enable);
+void clearSoftInterrupt();
+uint32_t getClusterHartId(uint8_t clusterId);
+uint32_t getClusterDmaHartId(uint8_t clusterId);
+void setClusterClockGating(volatile uint8_t *regPtr, uint8_t clusterId, bool enable);
+void setAllClusterClockGating(volatile uint8_t *regPtr, bool enable);
+void setClusterReset(volatile uint8_t *regPtr, uint8_t clusterId, bool enable);
+void setAllClusterReset(volatile uint8_t *regPtr, bool enable);
 void offloadToCluster(void *function, uint8_t hartId);
 void waitClusterBusy(uint8_t clusterId);
 uint32_t waitForCluster(uint8_t clusterId);
+bool pollCluster(uint8_t clusterId, uint32_t *retVal);
+void offloadToDmaCore(void *function, uint8_t clusterId);
+
+/* Returns the cluster of the calling Snitch hart. Inline so that kernels relocated
+ * with CLUSTER_TEXT can use it without calling into the library. */
+static inline uint32_t getClusterId() {
+    uint32_t hartId;
+    asm("csrr %0, mhartid" : "=r"(hartId)::);
+
+    // Hart 0 is the host, cluster harts are numbered from 1
+    uint32_t clusterId = 0;
+    uint32_t firstHart = 1;
+    while (hartId >= firstHart + _chimera_numCores[clusterId]) {
+        firstHart += _chimera_numCores[clusterId];
+        clusterId++;
+    }
+    return clusterId;
+}
+
+/* Flushes the narrow coalescers of the clusters set in clusterMask: read-ahead data
+ * is dropped and buffered writes are issued. Narrow reads of a cluster are only
+ * guaranteed to observe data written by other masters (host, other clusters, the
+ * cluster's own DMA) after a flush. Usable from both the host and cluster cores. */
+static inline void flushNarrowCoalescer(uint32_t clusterMask) {
+    *(volatile uint32_t *)(SOC_CTRL_BASE + CHIMERA_NARROW_COALESCE_FLUSH_REG_OFFSET) = clusterMask;
+    // Later accesses must not overtake the flush
+    asm volatile("fence" ::: "memory");
+}
+
+// Snitch Xdma instructions (custom-1 opcode), encoded directly as the library is
+// built without the Xdma extension. Only valid on the DMA core of a cluster.
+
+/* Starts a copy of size bytes and returns its transfer ID */
+static inline uint32_t clusterDmaStart1d(uint32_t dst, uint32_t src, uint32_t size) {
+    uint32_t tid;
+    // dmsrc, dmdst, dmcpyi
+    asm volatile(".insn r 0x2b, 0, 0, x0, %0, x0\n" ::"r"(src));
+    asm volatile(".insn r 0x2b, 0, 1, x0, %0, x0\n" ::"r"(dst));
+    asm volatile(".insn r 0x2b, 0, 2, %0, %1, x0\n" : "=r"(tid) : "r"(size));
+    return tid;
+}
+
+/* Starts reps copies of size bytes, advancing source and destination by their
+ * strides after each, and returns the transfer ID */
+static inline uint32_t clusterDmaStart2d(uint32_t dst, uint32_t src, uint32_t size,
+                                         uint32_t dstStride, uint32_t srcStride, uint32_t reps) {
+    uint32_t tid;
+    // dmsrc, dmdst, dmstr, dmrep, then dmcpyi with the 2D flag (immediate 2)
+    asm volatile(".insn r 0x2b, 0, 0, x0, %0, x0\n" ::"r"(src));
+    asm volatile(".insn r 0x2b, 0, 1, x0, %0, x0\n" ::"r"(dst));
+    asm volatile(".insn r 0x2b, 0, 6, x0, %0, %1\n" ::"r"(srcStride), "r"(dstStride));
+    asm volatile(".insn r 0x2b, 0, 7, x0, %0, x0\n" ::"r"(reps));
+    asm volatile(".insn r 0x2b, 0, 2, %0, %1, x2\n" : "=r"(tid) : "r"(size));
+    return tid;
+}
+
+/* Waits until all transfers issued by this DMA core have completed, then flushes the
+ * cluster's narrow coalescer so that its cores observe the transferred data */
+static inline void clusterDmaWait() {
+    uint32_t busy;
+    // dmstati with immediate 2 returns the busy status
+    do {
+        asm volatile(".insn r 0x2b, 0, 4, %0, x0, x2\n" : "=r"(busy));
+    } while (busy != 0);
+    flushNarrowCoalescer(1 << getClusterId());
+}
 
 #endif
@@ -4,7 +4,7 @@
 // Copyright 2024 ETH Zurich and University of Bologna.
 
 // Licensing information found in source file:
-//
+// 
 // SPDX-License-Identifier: SHL-0.51
 
 #ifndef _CHIMERA_REG_DEFS_
@@ -120,8 +120,20 @@ extern "C" {
 #define CHIMERA_CLUSTER_4_BUSY_REG_OFFSET 0x6c
 #define CHIMERA_CLUSTER_4_BUSY_CLUSTER_4_BUSY_BIT 0
 
+// Write 1 to bit i to flush the narrow coalescer of cluster i: drop its
+// read-ahead data and issue its buffered writes
+#define CHIMERA_NARROW_COALESCE_FLUSH_REG_OFFSET 0x70
+#define CHIMERA_NARROW_COALESCE_FLUSH_NARROW_COALESCE_FLUSH_MASK 0x1f
+#define CHIMERA_NARROW_COALESCE_FLUSH_NARROW_COALESCE_FLUSH_OFFSET 0
+#define CHIMERA_NARROW_COALESCE_FLUSH_NARROW_COALESCE_FLUSH_FIELD \
+  ((bitfield_field32_t) { .mask = CHIMERA_NARROW_COALESCE_FLUSH_NARROW_COALESCE_FLUSH_MASK, .index = CHIMERA_NARROW_COALESCE_FLUSH_NARROW_COALESCE_FLUSH_OFFSET })
+
+// Address of the trace rings in which the Snitch bootrom records kernel
+// start and return events, 0 disables them
+#define CHIMERA_SNITCH_TRACE_ADDR_REG_OFFSET 0x74
+
 #ifdef __cplusplus
-} // extern "C"
+}  // extern "C"
 #endif
-#endif // _CHIMERA_REG_DEFS_
-       // End generated register defines for chimera
\ No newline at end of file
+#endif  // _CHIMERA_REG_DEFS_
+// End generated register defines for chimera
\ No newline at end of file
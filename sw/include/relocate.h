@@ -0,0 +1,37 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Kernel code relocation into cluster TCDM. Functions marked CLUSTER_TEXT are
+// linked into the .cluster_text section, which the cluster's DMA copies to the top
+// of its TCDM. Dispatching the relocated copy makes instruction fetches local to
+// the cluster instead of going through the memory island.
+//
+// The section is copied as a whole, so calls between CLUSTER_TEXT functions stay
+// valid. Calls from CLUSTER_TEXT code to functions outside the section, including
+// library calls the compiler may emit for memcpy-like loops, are not supported:
+// calls are always PC-relative. Global data stays where it was linked; this relies
+// on the objects holding CLUSTER_TEXT code being built with -mcmodel=medlow, which
+// addresses globals absolutely instead of relative to the PC. Such sources must be
+// listed in CHIM_SW_CLUSTER_TEXT_SRCS (see sw/sw.mk).
+//
+// prewarmRelocated moves the one-time cost of a relocation off the first kernel
+// invocation: the I-cache invalidation and the first reads of the copied code. It
+// never runs a kernel. Snitch has no instruction prefetch, so I-cache lines are
+// still filled by the first invocation's fetches, which hit the local TCDM.
+
+#ifndef _RELOCATE_INCLUDE_GUARD_
+#define _RELOCATE_INCLUDE_GUARD_
+
+#include <stdint.h>
+
+#define CLUSTER_TEXT __attribute__((section(".cluster_text"), noinline))
+
+int32_t relocateToCluster(uint8_t clusterId);
+void *getRelocatedAddr(void *function, uint8_t clusterId);
+void offloadRelocated(void *function, uint8_t clusterId);
+int32_t prewarmRelocated(uint8_t clusterId);
+
+#endif
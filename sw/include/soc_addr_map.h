@@ -8,7 +8,9 @@
 #ifndef _SOC_ADDR_MAP_INCLUDE_GUARD_
 #define _SOC_ADDR_MAP_INCLUDE_GUARD_
 
+#ifndef __ASSEMBLER__
 #include <stdint.h>
+#endif
 
 #define CLINT_CTRL_BASE 0x02040000
 
@@ -20,14 +22,42 @@
 #define CLUSTER_3_BASE 0x40600000
 #define CLUSTER_4_BASE 0x40800000
 
+// Address space reserved for each cluster, starting at its base
+#define CLUSTER_ADDR_SPACE 0x00200000
+// TCDM at the start of each cluster's address space
+#define CLUSTER_TCDM_SIZE 0x00020000
+// Top of the TCDM reserved for relocated kernel code
+#define CLUSTER_TEXT_SIZE 0x00004000
+#define CLUSTER_TEXT_OFFSET (CLUSTER_TCDM_SIZE - CLUSTER_TEXT_SIZE)
+// Stack of each cluster core, set up by the Snitch bootrom below the relocated code:
+// the stack of core i grows down from CLUSTER_TEXT_OFFSET - i * CLUSTER_STACK_SIZE
+#define CLUSTER_STACK_SIZE 0x00000800
+
+// Writes to the multicast window land in every cluster selected by the mask,
+// at the same offset within each cluster's address space
+#define MULTICAST_BASE 0x44000000
+#define MULTICAST_ADDR(clusterMask, offset) \
+    (MULTICAST_BASE | ((uint32_t)(clusterMask) << 21) | ((offset) & (CLUSTER_ADDR_SPACE - 1)))
+
+#define MEMISL_BASE 0x48000000
+// The memory island interleaves its wide banks every MEMISL_BANK_WIDTH bytes, one
+// wide word: chimera_pkg MemIslNumWideBanks = 2, and WideDataWidth = AxiDataWidth (32)
+// * MemIslNarrowToWideFactor (4) = 128 bit in chimera_memisland_domain.sv
+#define MEMISL_NUM_BANKS 2
+#define MEMISL_BANK_WIDTH 16
+
 #define CLUSTER_0_NUMCORES 9
 #define CLUSTER_1_NUMCORES 9
 #define CLUSTER_2_NUMCORES 9
 #define CLUSTER_3_NUMCORES 9
 #define CLUSTER_4_NUMCORES 9
 
+#ifndef __ASSEMBLER__
 static uint8_t _chimera_numCores[] = {CLUSTER_0_NUMCORES, CLUSTER_1_NUMCORES, CLUSTER_2_NUMCORES,
                                       CLUSTER_3_NUMCORES, CLUSTER_4_NUMCORES};
+static uint32_t _chimera_clusterBase[] = {CLUSTER_0_BASE, CLUSTER_1_BASE, CLUSTER_2_BASE,
+                                          CLUSTER_3_BASE, CLUSTER_4_BASE};
+#endif
 #define _chimera_numClusters 5
 
 #define CHIMERA_PADFRAME_BASE_ADDRESS 0x30002000
@@ -0,0 +1,71 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Host-side task-graph scheduler. Kernels are added as tasks together with the
+// buffers they read and write and the tasks they depend on. tgRun dispatches
+// ready tasks onto idle clusters, preferring the cluster that already holds a
+// task's inputs, and starts successors as completions arrive.
+
+#ifndef _TASKGRAPH_INCLUDE_GUARD_
+#define _TASKGRAPH_INCLUDE_GUARD_
+
+#include "soc_addr_map.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TG_MAX_TASKS 32
+#define TG_MAX_BUFFERS 4
+#define TG_MAX_SUCCS 8
+
+#define TG_ALL_CLUSTERS ((1 << _chimera_numClusters) - 1)
+
+// Error codes returned by the task-graph API
+#define TG_OK 0
+#define TG_ERR_FULL -1
+#define TG_ERR_INVALID -2
+#define TG_ERR_CYCLE -3
+#define TG_ERR_KERNEL -4
+
+// Kernels run on core 0 of the selected cluster
+typedef int32_t (*tgKernel_t)(void *arg);
+
+typedef enum { TG_TASK_WAITING, TG_TASK_READY, TG_TASK_RUNNING, TG_TASK_DONE } tgTaskState_t;
+
+typedef struct {
+    uintptr_t addr;
+    uint32_t size;
+} tgBuffer_t;
+
+typedef struct {
+    tgKernel_t kernel;
+    void *arg;
+    tgBuffer_t inputs[TG_MAX_BUFFERS];
+    tgBuffer_t outputs[TG_MAX_BUFFERS];
+    uint8_t numInputs;
+    uint8_t numOutputs;
+    uint8_t succs[TG_MAX_SUCCS];
+    uint8_t numSuccs;
+    uint8_t numPreds;
+    uint8_t pendingPreds;
+    tgTaskState_t state;
+    int8_t cluster;   // Cluster the task ran on, -1 before dispatch
+    uint8_t doneSeq;  // Completion order, used to find the latest producer of a buffer
+    int32_t retVal;
+} tgTask_t;
+
+typedef struct {
+    tgTask_t tasks[TG_MAX_TASKS];
+    uint8_t numTasks;
+} tgGraph_t;
+
+void tgInit(tgGraph_t *graph);
+int32_t tgAddTask(tgGraph_t *graph, tgKernel_t kernel, void *arg);
+int32_t tgAddInput(tgGraph_t *graph, int32_t task, void *addr, uint32_t size);
+int32_t tgAddOutput(tgGraph_t *graph, int32_t task, void *addr, uint32_t size);
+int32_t tgAddDependency(tgGraph_t *graph, int32_t pred, int32_t succ);
+int32_t tgRun(tgGraph_t *graph, uint8_t clusterMask);
+
+#endif
@@ -0,0 +1,47 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Self-scheduling cluster runtime. Once started, core 0 of each selected cluster
+// runs a worker loop that claims tasks from a shared queue in the memory island
+// with atomic ticket counters and only sleeps in wfi while the queue is empty.
+// The host enqueues tasks without a per-task round trip to the clusters.
+
+#ifndef _TASKPOOL_INCLUDE_GUARD_
+#define _TASKPOOL_INCLUDE_GUARD_
+
+#include "soc_addr_map.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TP_NUM_SLOTS 64
+// Polls of an empty slot before a worker goes to sleep
+#define TP_SPIN_ITERS 64
+
+typedef int32_t (*tpKernel_t)(void *arg);
+
+typedef struct {
+    tpKernel_t kernel;
+    void *arg;
+    uint32_t seq; // Ticket + 1 once filled, 0 while free
+} tpSlot_t;
+
+typedef struct {
+    tpSlot_t slots[TP_NUM_SLOTS];
+    uint32_t head;                               // Next ticket claimed by a worker
+    uint32_t tail;                               // Next ticket filled by the host
+    uint32_t pushed;                             // Tasks enqueued since tpStart
+    uint32_t done;                               // Tasks completed since tpStart
+    uint32_t errors;                             // Tasks that returned non-zero
+    uint32_t sleepTicket[_chimera_numClusters];  // Ticket + 1 a worker sleeps on, 0 if awake
+    uint8_t clusterMask;
+} tpPool_t;
+
+void tpStart(uint8_t clusterMask);
+void tpPush(tpKernel_t kernel, void *arg);
+uint32_t tpWait();
+uint32_t tpStop();
+
+#endif
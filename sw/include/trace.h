@@ -0,0 +1,121 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Binary trace ring buffers in the memory island. Each cluster and the host own one
+// ring; any hart appends timestamped events to the ring of its cluster with one
+// atomic and a few posted stores, without waiting for the host. The host drains
+// the rings whenever convenient with traceDrain, or prints them with traceDump for
+// scripts/trace_decode.py.
+//
+// Once traceInit has run, every offload is traced without changes to the caller:
+// the offload library records dispatch and collect events on the host ring, and
+// the Snitch bootrom records start and return events around each kernel it runs.
+// The bootrom finds the rings through the SNITCH_TRACE_ADDR register and writes
+// entries in the layout defined below.
+//
+// Producers never wait for free space: a full ring overwrites its oldest entries,
+// which the host detects through the per-entry sequence number and reports as lost.
+// Timestamps are the mcycle value of the emitting hart, so each ring counts in the
+// clock of its own cluster.
+
+#ifndef _TRACE_INCLUDE_GUARD_
+#define _TRACE_INCLUDE_GUARD_
+
+#include "soc_addr_map.h"
+
+#define TRACE_RING_ENTRIES 128 // Power of two
+#define TRACE_HOST_RING _chimera_numClusters
+#define TRACE_NUM_RINGS (_chimera_numClusters + 1)
+
+// Ring layout as seen by the bootrom: entries of 16 bytes, followed by the head
+#define TRACE_ENTRY_SIZE_LOG2 4
+#define TRACE_RING_HEAD_OFFSET (TRACE_RING_ENTRIES << TRACE_ENTRY_SIZE_LOG2)
+#define TRACE_RING_SIZE (TRACE_RING_HEAD_OFFSET + 4)
+
+// Events recorded by the runtime; kernels use ids from TRACE_EV_USER on
+#define TRACE_EV_DISPATCH 0x0001 // Host: kernel offloaded, arg = cluster id
+#define TRACE_EV_START 0x0002    // Cluster: kernel entered, arg = kernel address
+#define TRACE_EV_RETURN 0x0003   // Cluster: kernel returned, arg = return value
+#define TRACE_EV_COLLECT 0x0004  // Host: return value collected, arg = cluster id
+#define TRACE_EV_USER 0x0100
+
+#ifndef __ASSEMBLER__
+
+#include "offload.h"
+#include "regs/soc_ctrl.h"
+#include <stdint.h>
+
+typedef struct {
+    uint32_t seq;       // Ticket + 1 once written, 0 while being written
+    uint32_t timestamp; // mcycle of the emitting hart
+    uint32_t info;      // Event id in bits [31:16], hart id in bits [7:0]
+    uint32_t arg;
+} traceEntry_t;
+
+typedef struct {
+    traceEntry_t entries[TRACE_RING_ENTRIES];
+    uint32_t head; // Next ticket claimed by a producer
+} traceRing_t;
+
+_Static_assert(sizeof(traceRing_t) == TRACE_RING_SIZE, "trace ring layout used by the bootrom");
+
+// Event as returned to the host by traceDrain
+typedef struct {
+    uint32_t seq;
+    uint32_t timestamp;
+    uint32_t arg;
+    uint16_t event;
+    uint8_t hart;
+    uint8_t ring;
+} traceRecord_t;
+
+extern volatile traceRing_t traceRings[TRACE_NUM_RINGS];
+
+/* Appends an event to the ring of the calling hart's cluster within rings. Inline so
+ * that kernels relocated with CLUSTER_TEXT can trace without calling into the library. */
+static inline void traceEventTo(volatile traceRing_t *rings, uint16_t event, uint32_t arg) {
+    uint32_t hartId, timestamp, ticket;
+    asm volatile("csrr %0, mhartid" : "=r"(hartId));
+    asm volatile("csrr %0, mcycle" : "=r"(timestamp));
+
+    uint32_t ring = (hartId == 0) ? TRACE_HOST_RING : getClusterId();
+
+    // Claim a ticket (amoadd.w.aqrl)
+    asm volatile(".insn r 0x2f, 2, 3, %0, %1, %2\n"
+                 : "=r"(ticket)
+                 : "r"(&rings[ring].head), "r"(1)
+                 : "memory");
+
+    volatile traceEntry_t *entry = &rings[ring].entries[ticket % TRACE_RING_ENTRIES];
+    entry->seq = 0;
+    entry->timestamp = timestamp;
+    entry->info = ((uint32_t)event << 16) | (hartId & 0xff);
+    entry->arg = arg;
+    entry->seq = ticket + 1;
+}
+
+/* Appends an event to the ring of the calling hart's cluster */
+static inline void traceEvent(uint16_t event, uint32_t arg) {
+    traceEventTo(traceRings, event, arg);
+}
+
+/* Returns the rings enabled by traceInit, or NULL while tracing is off. The offload
+ * library uses this instead of traceRings, so that programs which do not trace
+ * carry no rings. */
+static inline volatile traceRing_t *traceActiveRings() {
+    volatile uint32_t *traceAddr =
+        (volatile uint32_t *)(SOC_CTRL_BASE + CHIMERA_SNITCH_TRACE_ADDR_REG_OFFSET);
+    return (volatile traceRing_t *)*traceAddr;
+}
+
+void traceInit();
+uint32_t traceDrain(traceRecord_t *records, uint32_t maxRecords);
+uint32_t traceLost(uint8_t ring);
+uint32_t traceDump();
+
+#endif
+
+#endif
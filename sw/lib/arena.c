@@ -0,0 +1,184 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+#include "arena.h"
+#include "soc_addr_map.h"
+#include <stddef.h>
+#include <stdint.h>
+
+extern char __heap_start[];
+extern char __stack_start[];
+
+static inline uint32_t arenaClassSize(uint32_t cls) {
+    return (uint32_t)ARENA_MIN_BLOCK << cls;
+}
+
+/* Smallest class whose blocks hold `bytes`, ARENA_NUM_CLASSES if none does */
+static uint32_t arenaClassOf(uint32_t bytes) {
+    uint32_t cls = 0;
+    while (cls < ARENA_NUM_CLASSES && arenaClassSize(cls) < bytes) {
+        cls++;
+    }
+    return cls;
+}
+
+static inline void arenaPush(arena_t *arena, uintptr_t block, uint32_t cls) {
+    arenaBlock_t *b = (arenaBlock_t *)block;
+    b->next = arena->freeList[cls];
+    arena->freeList[cls] = b;
+}
+
+static inline uintptr_t arenaPop(arena_t *arena, uint32_t cls) {
+    arenaBlock_t *b = arena->freeList[cls];
+    if (b != NULL) {
+        arena->freeList[cls] = b->next;
+    }
+    return (uintptr_t)b;
+}
+
+/* Takes a block of class cls from the free lists, splitting the smallest larger
+ * free block if needed. Returns 0 if there is none. */
+static uintptr_t arenaTakeFree(arena_t *arena, uint32_t cls) {
+    uint32_t from = cls;
+    while (from < ARENA_NUM_CLASSES && arena->freeList[from] == NULL) {
+        from++;
+    }
+    if (from == ARENA_NUM_CLASSES) return 0;
+
+    uintptr_t block = arenaPop(arena, from);
+    // Keep the lower half, return the upper halves to the smaller classes
+    while (from > cls) {
+        from--;
+        arenaPush(arena, block + arenaClassSize(from), from);
+    }
+    return block;
+}
+
+/* Carves a fresh block of class cls aligned to its size. The gap skipped to align
+ * it is returned to the free lists. Returns 0 if the arena is exhausted. */
+static uintptr_t arenaCarve(arena_t *arena, uint32_t cls) {
+    uint32_t size = arenaClassSize(cls);
+    uintptr_t block = (arena->bump + size - 1) & ~(uintptr_t)(size - 1);
+    if (block < arena->bump || block + size > arena->end) return 0;
+
+    while (arena->bump < block) {
+        uint32_t gapCls = cls;
+        while (gapCls > 0 && ((arena->bump & (arenaClassSize(gapCls) - 1)) != 0 ||
+                              arena->bump + arenaClassSize(gapCls) > block)) {
+            gapCls--;
+        }
+        arenaPush(arena, arena->bump, gapCls);
+        arena->bump += arenaClassSize(gapCls);
+    }
+
+    arena->bump = block + size;
+    return block;
+}
+
+/* Sets up an arena over [start, start + size) of a memory whose numBanks banks are
+ * interleaved every bankWidth bytes. The block class table is kept at the start of
+ * the region. Returns ARENA_OK or ARENA_ERR_INVALID. */
+int32_t arenaInit(arena_t *arena, void *start, uint32_t size, uint32_t numBanks,
+                  uint32_t bankWidth) {
+    if (arena == NULL || numBanks == 0 || bankWidth == 0 ||
+        ARENA_MIN_BLOCK % (numBanks * bankWidth) != 0) {
+        return ARENA_ERR_INVALID;
+    }
+
+    uintptr_t first = ((uintptr_t)start + ARENA_MIN_BLOCK - 1) & ~(uintptr_t)(ARENA_MIN_BLOCK - 1);
+    uintptr_t end = ((uintptr_t)start + size) & ~(uintptr_t)(ARENA_MIN_BLOCK - 1);
+    if (end <= first) return ARENA_ERR_INVALID;
+
+    uint32_t numChunks = (end - first) / ARENA_MIN_BLOCK;
+    uintptr_t base = (first + numChunks + ARENA_MIN_BLOCK - 1) & ~(uintptr_t)(ARENA_MIN_BLOCK - 1);
+    if (end <= base) return ARENA_ERR_INVALID;
+
+    arena->blockClass = (uint8_t *)first;
+    for (uint32_t i = 0; i < (end - base) / ARENA_MIN_BLOCK; i++) {
+        arena->blockClass[i] = 0;
+    }
+
+    arena->base = base;
+    arena->end = end;
+    arena->bump = base;
+    arena->numBanks = numBanks;
+    arena->bankWidth = bankWidth;
+    arena->nextBank = 0;
+    for (uint32_t i = 0; i < ARENA_NUM_CLASSES; i++) {
+        arena->freeList[i] = NULL;
+    }
+
+    return ARENA_OK;
+}
+
+/* Sets up an arena over the free memory island space between the program and the
+ * stack */
+int32_t arenaInitMemIsland(arena_t *arena) {
+    uintptr_t start = (uintptr_t)__heap_start;
+    uintptr_t end = (uintptr_t)__stack_start - ARENA_STACK_RESERVE;
+    if (end <= start) return ARENA_ERR_INVALID;
+
+    return arenaInit(arena, __heap_start, end - start, MEMISL_NUM_BANKS, MEMISL_BANK_WIDTH);
+}
+
+/* Sets up an arena over the first size bytes of HyperRAM, which must already be
+ * configured. HyperRAM has no bank interleaving, so bank hints other than 0 fail. */
+int32_t arenaInitHyperRam(arena_t *arena, uint32_t size) {
+    return arenaInit(arena, (void *)HYPERRAM_BASE, size, 1, ARENA_MIN_BLOCK);
+}
+
+/* Allocates size bytes aligned to align (a power of two, 0 for no constraint) and
+ * starting in the given bank, or in the next bank of a rotation for ARENA_ANY_BANK.
+ * A bank other than 0 only guarantees alignment up to the bank width. Returns NULL
+ * if the request cannot be satisfied. */
+void *arenaAlloc(arena_t *arena, uint32_t size, uint32_t align, uint8_t bank) {
+    if (size == 0 || (align & (align - 1)) != 0) return NULL;
+
+    if (bank == ARENA_ANY_BANK) {
+        bank = 0;
+        if (align <= arena->bankWidth) {
+            bank = arena->nextBank;
+            arena->nextBank = (arena->nextBank + 1) % arena->numBanks;
+        }
+    } else if (bank >= arena->numBanks || (bank != 0 && align > arena->bankWidth)) {
+        return NULL;
+    }
+
+    // Blocks start in bank 0, the hint is an offset into the block
+    uint32_t offset = bank * arena->bankWidth;
+    uint32_t cls = arenaClassOf(size + offset);
+    uint32_t alignCls = arenaClassOf(align);
+    if (alignCls > cls) cls = alignCls;
+    if (cls >= ARENA_NUM_CLASSES || size + offset < size) return NULL;
+
+    uintptr_t block = arenaTakeFree(arena, cls);
+    if (block == 0) block = arenaCarve(arena, cls);
+    if (block == 0) return NULL;
+
+    arena->blockClass[(block - arena->base) / ARENA_MIN_BLOCK] = cls + 1;
+    return (void *)(block + offset);
+}
+
+/* Returns a buffer from arenaAlloc to its size class. Freed blocks are not merged.
+ * Returns ARENA_ERR_INVALID for pointers not allocated from the arena, including
+ * buffers already freed. */
+int32_t arenaFree(arena_t *arena, void *ptr) {
+    uintptr_t p = (uintptr_t)ptr;
+    if (p < arena->base || p >= arena->bump) return ARENA_ERR_INVALID;
+
+    uint32_t idx = (p - arena->base) / ARENA_MIN_BLOCK;
+    uint32_t cls = arena->blockClass[idx];
+    if (cls == 0) return ARENA_ERR_INVALID;
+
+    arena->blockClass[idx] = 0;
+    arenaPush(arena, arena->base + idx * ARENA_MIN_BLOCK, cls - 1);
+    return ARENA_OK;
+}
+
+/* Returns the bank an address of the arena falls into */
+uint32_t arenaBankOf(const arena_t *arena, const void *ptr) {
+    return ((uintptr_t)ptr / arena->bankWidth) % arena->numBanks;
+}
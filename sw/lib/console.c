@@ -0,0 +1,20 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+#include "console.h"
+#include "dif/clint.h"
+#include "dif/uart.h"
+#include "params.h"
+#include "regs/cheshire.h"
+#include "util.h"
+#include <stdint.h>
+
+/* Sets up the UART at the boot baud rate for the current core clock. Host only. */
+void consoleInit() {
+    uint32_t rtcFreq = *reg32(&__base_regs, CHESHIRE_RTC_FREQ_REG_OFFSET);
+    uint64_t resetFreq = clint_get_core_freq(rtcFreq, 2500);
+    uart_init(&__base_uart, resetFreq, __BOOT_BAUDRATE);
+}
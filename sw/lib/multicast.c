@@ -0,0 +1,37 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+#include "multicast.h"
+#include "dif/dma.h"
+#include "regs/soc_ctrl.h"
+#include "soc_addr_map.h"
+#include <stdint.h>
+
+/* Returns whether a cluster is out of reset and its clock is running */
+static int clusterActive(uint8_t clusterId) {
+    volatile uint32_t *resetReg =
+        (volatile uint32_t *)(SOC_CTRL_BASE + CHIMERA_RESET_CLUSTER_0_REG_OFFSET) + clusterId;
+    volatile uint32_t *clkGateReg =
+        (volatile uint32_t *)(SOC_CTRL_BASE + CHIMERA_CLUSTER_0_CLK_GATE_EN_REG_OFFSET) +
+        clusterId;
+
+    return (*resetReg & 1) == 0 && (*clkGateReg & 1) == 0;
+}
+
+/* Copies size bytes from src to the given offset in the address space of every
+ * cluster selected by clusterMask, as bursts of the Cheshire DMA. Blocks until the
+ * copy has completed. Returns MULTICAST_ERR_INACTIVE without writing anything if a
+ * selected cluster is held in reset or clock gated. Host only. */
+int32_t broadcastToClusters(uint8_t clusterMask, uint32_t offset, const void *src, uint32_t size) {
+    for (uint8_t c = 0; c < _chimera_numClusters; c++) {
+        if (((clusterMask >> c) & 1) && !clusterActive(c)) return MULTICAST_ERR_INACTIVE;
+    }
+    if (clusterMask == 0 || size == 0) return MULTICAST_OK;
+
+    sys_dma_blk_memcpy((uintptr_t)MULTICAST_ADDR(clusterMask, offset), (uintptr_t)src, size);
+
+    return MULTICAST_OK;
+}
@@ -6,12 +6,17 @@
 // Viviane Potocnik <vivianep@iis.ee.ethz.ch>
 // Lorenzo Leone <lleone@iis.ee.ethz.ch>
 
+#include "offload.h"
 #include "regs/soc_ctrl.h"
 #include "soc_addr_map.h"
+#include "trace.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
+// Function dispatched to the DMA core of each cluster, cleared once the core took it
+static void *volatile dmaCoreSlots[_chimera_numClusters];
+
 void setupInterruptHandler(void *handler) {
     volatile void **snitchTrapHandlerAddr =
         (volatile void **)(SOC_CTRL_BASE + CHIMERA_SNITCH_INTR_HANDLER_ADDR_REG_OFFSET);
@@ -19,6 +24,30 @@ void setupInterruptHandler(void *handler) {
     *snitchTrapHandlerAddr = handler;
 }
 
+/* Trap handler for cluster cores that only clears the software interrupt which
+ * woke the calling hart */
+void clearSoftInterrupt() {
+    uint8_t hartId;
+    asm("csrr %0, mhartid" : "=r"(hartId)::);
+
+    volatile uint32_t *interruptTarget = ((uint32_t *)CLINT_CTRL_BASE) + hartId;
+    *interruptTarget = 0;
+}
+
+/* Returns the hart ID of core 0 of a cluster; hart 0 is the host */
+uint32_t getClusterHartId(uint8_t clusterId) {
+    uint32_t hartId = 1;
+    for (uint32_t i = 0; i < clusterId; i++) {
+        hartId += _chimera_numCores[i];
+    }
+    return hartId;
+}
+
+/* Returns the hart ID of the DMA core, the last core of a cluster */
+uint32_t getClusterDmaHartId(uint8_t clusterId) {
+    return getClusterHartId(clusterId) + _chimera_numCores[clusterId] - 1;
+}
+
 void waitClusterBusy(uint8_t clusterId) {
     volatile int32_t *busy_ptr;
 
@@ -105,6 +134,14 @@ void setAllClusterReset(volatile uint8_t *regPtr, bool enable) {
     *(regPtr + CHIMERA_RESET_CLUSTER_4_REG_OFFSET) = enable;
 }
 
+/* Records an event on the host ring if traceInit enabled tracing */
+static void traceHostEvent(uint16_t event, uint8_t clusterId) {
+    volatile traceRing_t *rings = traceActiveRings();
+    if (rings != NULL) {
+        traceEventTo(rings, event, clusterId);
+    }
+}
+
 /* Offloads a void function pointer to the specified cluster's core 0 */
 void offloadToCluster(void *function, uint8_t clusterId) {
 
@@ -113,20 +150,17 @@ void offloadToCluster(void *function, uint8_t clusterId) {
 
     *snitchBootAddr = function;
 
-    uint32_t hartId = 1;
-    for (uint32_t i = 0; i < clusterId; i++) {
-        hartId += _chimera_numCores[i];
-    }
-
-    volatile uint32_t *interruptTarget = ((uint32_t *)CLINT_CTRL_BASE) + hartId;
+    volatile uint32_t *interruptTarget =
+        ((uint32_t *)CLINT_CTRL_BASE) + getClusterHartId(clusterId);
     waitClusterBusy(clusterId);
+    // The kernel must observe what the host wrote since the cluster last ran
+    flushNarrowCoalescer(1 << clusterId);
+    traceHostEvent(TRACE_EV_DISPATCH, clusterId);
     *interruptTarget = 1;
 }
 
-/* Busy waits for the return of a cluster, clears the return register, and
- * returns the return value */
-uint32_t waitForCluster(uint8_t clusterId) {
-    volatile int32_t *snitchReturnAddr;
+static volatile int32_t *getClusterReturnReg(uint8_t clusterId) {
+    volatile int32_t *snitchReturnAddr = NULL;
     if (clusterId == 0) {
         snitchReturnAddr =
             (volatile int32_t *)(SOC_CTRL_BASE + CHIMERA_SNITCH_CLUSTER_0_RETURN_REG_OFFSET);
@@ -143,12 +177,66 @@ uint32_t waitForCluster(uint8_t clusterId) {
         snitchReturnAddr =
             (volatile int32_t *)(SOC_CTRL_BASE + CHIMERA_SNITCH_CLUSTER_4_RETURN_REG_OFFSET);
     }
+    return snitchReturnAddr;
+}
+
+/* Busy waits for the return of a cluster, clears the return register, and
+ * returns the return value */
+uint32_t waitForCluster(uint8_t clusterId) {
+    volatile int32_t *snitchReturnAddr = getClusterReturnReg(clusterId);
 
     while (*snitchReturnAddr == 0) {
     }
 
     uint32_t retVal = *snitchReturnAddr;
     *snitchReturnAddr = 0;
+    traceHostEvent(TRACE_EV_COLLECT, clusterId);
 
     return retVal;
 }
+
+/* Checks once whether a cluster has returned. If so, clears the return register,
+ * stores the return value in retVal and returns true */
+bool pollCluster(uint8_t clusterId, uint32_t *retVal) {
+    volatile int32_t *snitchReturnAddr = getClusterReturnReg(clusterId);
+
+    uint32_t ret = *snitchReturnAddr;
+    if (ret == 0) {
+        return false;
+    }
+
+    *snitchReturnAddr = 0;
+    *retVal = ret;
+    traceHostEvent(TRACE_EV_COLLECT, clusterId);
+
+    return true;
+}
+
+/* Runs on the DMA core: takes the function dispatched to it and runs it */
+static int32_t dmaCoreEntry() {
+    uint32_t clusterId = getClusterId();
+    void *function = dmaCoreSlots[clusterId];
+    dmaCoreSlots[clusterId] = NULL;
+
+    return ((int32_t(*)())function)();
+}
+
+/* Wakes the DMA core of a cluster to run a function and returns once the core has
+ * taken it, so that the shared boot address may be overwritten. The DMA core does
+ * not report its return; the function must signal completion itself, e.g. with a
+ * flag in TCDM. The core may be woken up again as soon as that flag is set: the
+ * bootrom keeps a wake-up raised before the core is back in wfi pending. */
+void offloadToDmaCore(void *function, uint8_t clusterId) {
+    volatile void **snitchBootAddr =
+        (volatile void **)(SOC_CTRL_BASE + CHIMERA_SNITCH_BOOT_ADDR_REG_OFFSET);
+
+    waitClusterBusy(clusterId);
+    dmaCoreSlots[clusterId] = function;
+    *snitchBootAddr = dmaCoreEntry;
+    flushNarrowCoalescer(1 << clusterId);
+    traceHostEvent(TRACE_EV_DISPATCH, clusterId);
+    *(((volatile uint32_t *)CLINT_CTRL_BASE) + getClusterDmaHartId(clusterId)) = 1;
+
+    while (dmaCoreSlots[clusterId] != NULL) {
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+#include "relocate.h"
+#include "offload.h"
+#include "soc_addr_map.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+extern char __cluster_text_start[];
+extern char __cluster_text_end[];
+
+// Per-cluster state shared with the cluster cores
+typedef struct {
+    void *function;  // Relocated kernel to run on core 0
+    uint32_t stale;  // Set when new code was copied; core 0 must flush its I-cache
+    uint32_t warm;   // Set for a warm-up run: check the copy instead of running a kernel
+    uint32_t dmaDone;
+} relocSlot_t;
+
+static volatile relocSlot_t relocSlots[_chimera_numClusters];
+
+/* Runs on the cluster's DMA core: copy .cluster_text into the local TCDM */
+static int32_t relocDmaCopy() {
+    uint32_t clusterId = getClusterId();
+    uint32_t src = (uint32_t)__cluster_text_start;
+    uint32_t dst = _chimera_clusterBase[clusterId] + CLUSTER_TEXT_OFFSET;
+    uint32_t size = __cluster_text_end - __cluster_text_start;
+
+    clusterDmaStart1d(dst, src, size);
+    clusterDmaWait();
+
+    relocSlots[clusterId].dmaDone = 1;
+    return 0;
+}
+
+/* Runs on core 0 for a warm-up: reads the relocated code back and compares it with
+ * the original. Returns 0 if the copy is complete. */
+static int32_t relocCheckCopy(uint32_t clusterId) {
+    volatile uint32_t *copy =
+        (volatile uint32_t *)(_chimera_clusterBase[clusterId] + CLUSTER_TEXT_OFFSET);
+    volatile uint32_t *orig = (volatile uint32_t *)__cluster_text_start;
+    uint32_t words = (__cluster_text_end - __cluster_text_start) / sizeof(uint32_t);
+
+    for (uint32_t i = 0; i < words; i++) {
+        if (copy[i] != orig[i]) return -1;
+    }
+    return 0;
+}
+
+/* Runs on core 0: drop stale I-cache lines after a relocation, then run the kernel,
+ * or only check the copy for a warm-up. Uses the core's stack, which the bootrom
+ * sets up in TCDM. */
+static int32_t relocEntry() {
+    uint32_t clusterId = getClusterId();
+    volatile relocSlot_t *slot = &relocSlots[clusterId];
+    if (slot->stale) {
+        // fence.i, encoded directly as the library is built without Zifencei
+        asm volatile(".insn i 0x0f, 1, x0, x0, 0\n" ::: "memory");
+        slot->stale = 0;
+    }
+
+    if (slot->warm) {
+        slot->warm = 0;
+        return relocCheckCopy(clusterId);
+    }
+
+    return ((int32_t(*)())slot->function)();
+}
+
+/* Copies all CLUSTER_TEXT code into the TCDM of the given cluster using its DMA
+ * core. Returns 0 on success, -1 if the code does not fit into the reserved region. */
+int32_t relocateToCluster(uint8_t clusterId) {
+    uint32_t size = __cluster_text_end - __cluster_text_start;
+    if (size > CLUSTER_TEXT_SIZE) return -1;
+    if (size == 0) return 0;
+
+    setupInterruptHandler(clearSoftInterrupt);
+
+    relocSlots[clusterId].dmaDone = 0;
+    relocSlots[clusterId].stale = 1;
+    offloadToDmaCore(relocDmaCopy, clusterId);
+
+    while (relocSlots[clusterId].dmaDone == 0) {
+    }
+
+    return 0;
+}
+
+/* Returns the address of a CLUSTER_TEXT function inside the cluster's relocated copy */
+void *getRelocatedAddr(void *function, uint8_t clusterId) {
+    return (void *)(_chimera_clusterBase[clusterId] + CLUSTER_TEXT_OFFSET +
+                    ((char *)function - __cluster_text_start));
+}
+
+/* Offloads the relocated copy of a CLUSTER_TEXT function to the cluster's core 0.
+ * The cluster must have been set up with relocateToCluster. */
+void offloadRelocated(void *function, uint8_t clusterId) {
+    relocSlots[clusterId].function = getRelocatedAddr(function, clusterId);
+    asm volatile("fence" ::: "memory");
+
+    setupInterruptHandler(clearSoftInterrupt);
+    offloadToCluster(relocEntry, clusterId);
+}
+
+/* Prepares a relocated cluster for its first invocation without running any kernel.
+ * Core 0 performs the pending I-cache invalidation and reads the relocated code back
+ * through its data port. Returns 0 on success, -1 if the copy does not match. */
+int32_t prewarmRelocated(uint8_t clusterId) {
+    relocSlots[clusterId].warm = 1;
+    asm volatile("fence" ::: "memory");
+
+    setupInterruptHandler(clearSoftInterrupt);
+    offloadToCluster(relocEntry, clusterId);
+
+    return (waitForCluster(clusterId) == 1) ? 0 : -1;
+}
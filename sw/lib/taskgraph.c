@@ -0,0 +1,242 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+#include "taskgraph.h"
+#include "offload.h"
+#include "regs/soc_ctrl.h"
+#include "soc_addr_map.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Per-cluster dispatch slot. All clusters boot into tgTrampoline, which picks up
+// its kernel here; the shared boot address register therefore never changes while
+// clusters are being woken up.
+typedef struct {
+    tgKernel_t kernel;
+    void *arg;
+    int32_t retVal;
+} tgSlot_t;
+
+static volatile tgSlot_t tgSlots[_chimera_numClusters];
+
+/* Runs on the cluster: execute the kernel dispatched to this cluster. Not a leaf:
+ * ra is spilled to the core's stack, which the bootrom sets up in TCDM. */
+static int32_t tgTrampoline() {
+    volatile tgSlot_t *slot = &tgSlots[getClusterId()];
+    slot->retVal = slot->kernel(slot->arg);
+
+    return 0;
+}
+
+void tgInit(tgGraph_t *graph) {
+    graph->numTasks = 0;
+}
+
+/* Adds a task and returns its ID, TG_ERR_INVALID for a NULL kernel or TG_ERR_FULL */
+int32_t tgAddTask(tgGraph_t *graph, tgKernel_t kernel, void *arg) {
+    if (kernel == NULL) return TG_ERR_INVALID;
+    if (graph->numTasks == TG_MAX_TASKS) return TG_ERR_FULL;
+
+    tgTask_t *task = &graph->tasks[graph->numTasks];
+    task->kernel = kernel;
+    task->arg = arg;
+    task->numInputs = 0;
+    task->numOutputs = 0;
+    task->numSuccs = 0;
+    task->numPreds = 0;
+
+    return graph->numTasks++;
+}
+
+/* Declares a buffer read by the task; used to place the task near its data */
+int32_t tgAddInput(tgGraph_t *graph, int32_t task, void *addr, uint32_t size) {
+    if (task < 0 || task >= graph->numTasks) return TG_ERR_INVALID;
+
+    tgTask_t *t = &graph->tasks[task];
+    if (t->numInputs == TG_MAX_BUFFERS) return TG_ERR_FULL;
+
+    t->inputs[t->numInputs].addr = (uintptr_t)addr;
+    t->inputs[t->numInputs].size = size;
+    t->numInputs++;
+
+    return TG_OK;
+}
+
+/* Declares a buffer written by the task */
+int32_t tgAddOutput(tgGraph_t *graph, int32_t task, void *addr, uint32_t size) {
+    if (task < 0 || task >= graph->numTasks) return TG_ERR_INVALID;
+
+    tgTask_t *t = &graph->tasks[task];
+    if (t->numOutputs == TG_MAX_BUFFERS) return TG_ERR_FULL;
+
+    t->outputs[t->numOutputs].addr = (uintptr_t)addr;
+    t->outputs[t->numOutputs].size = size;
+    t->numOutputs++;
+
+    return TG_OK;
+}
+
+/* Makes succ wait for the completion of pred */
+int32_t tgAddDependency(tgGraph_t *graph, int32_t pred, int32_t succ) {
+    if (pred < 0 || pred >= graph->numTasks || succ < 0 || succ >= graph->numTasks ||
+        pred == succ) {
+        return TG_ERR_INVALID;
+    }
+
+    tgTask_t *p = &graph->tasks[pred];
+    if (p->numSuccs == TG_MAX_SUCCS) return TG_ERR_FULL;
+
+    p->succs[p->numSuccs++] = succ;
+    graph->tasks[succ].numPreds++;
+
+    return TG_OK;
+}
+
+static bool tgOverlaps(const tgBuffer_t *a, const tgBuffer_t *b) {
+    return a->addr < b->addr + b->size && b->addr < a->addr + a->size;
+}
+
+/* Returns the cluster holding a buffer: the owner of the TCDM it lives in, or the
+ * cluster that last produced it. -1 if no cluster is closer than any other. */
+static int32_t tgBufferHolder(tgGraph_t *graph, const tgBuffer_t *buf) {
+    for (int32_t c = 0; c < _chimera_numClusters; c++) {
+        if (buf->addr >= _chimera_clusterBase[c] &&
+            buf->addr < _chimera_clusterBase[c] + CLUSTER_ADDR_SPACE) {
+            return c;
+        }
+    }
+
+    int32_t holder = -1;
+    uint8_t latest = 0;
+    for (uint32_t i = 0; i < graph->numTasks; i++) {
+        tgTask_t *t = &graph->tasks[i];
+        if (t->state != TG_TASK_DONE || t->doneSeq <= latest) continue;
+        for (uint32_t o = 0; o < t->numOutputs; o++) {
+            if (tgOverlaps(buf, &t->outputs[o])) {
+                holder = t->cluster;
+                latest = t->doneSeq;
+                break;
+            }
+        }
+    }
+
+    return holder;
+}
+
+/* Picks the idle cluster holding most of the task's input bytes, -1 if none is idle */
+static int32_t tgPickCluster(tgGraph_t *graph, tgTask_t *task, const int32_t *running,
+                             uint8_t clusterMask) {
+    uint32_t score[_chimera_numClusters] = {0};
+
+    for (uint32_t i = 0; i < task->numInputs; i++) {
+        int32_t holder = tgBufferHolder(graph, &task->inputs[i]);
+        if (holder >= 0) score[holder] += task->inputs[i].size;
+    }
+
+    int32_t best = -1;
+    for (int32_t c = 0; c < _chimera_numClusters; c++) {
+        if (!(clusterMask & (1 << c)) || running[c] >= 0) continue;
+        if (best < 0 || score[c] > score[best]) best = c;
+    }
+
+    return best;
+}
+
+static void tgDispatch(tgTask_t *task, int32_t cluster) {
+    tgSlots[cluster].kernel = task->kernel;
+    tgSlots[cluster].arg = task->arg;
+    tgSlots[cluster].retVal = 0;
+    // The slot must be visible to the cluster before it is woken up
+    asm volatile("fence" ::: "memory");
+
+    task->state = TG_TASK_RUNNING;
+    task->cluster = cluster;
+    offloadToCluster(tgTrampoline, cluster);
+}
+
+/* Runs all tasks of the graph on the clusters selected by clusterMask. Returns TG_OK
+ * once every task has completed, TG_ERR_KERNEL if a kernel returned non-zero (no
+ * further tasks are started), or TG_ERR_CYCLE if the dependencies cannot be met.
+ * Each task's return value is available in its retVal field. */
+int32_t tgRun(tgGraph_t *graph, uint8_t clusterMask) {
+    uint8_t *regPtr = (uint8_t *)SOC_CTRL_BASE;
+    int32_t running[_chimera_numClusters];
+    uint32_t numRunning = 0;
+    uint32_t numDone = 0;
+    uint8_t doneSeq = 0;
+    int32_t status = TG_OK;
+
+    clusterMask &= TG_ALL_CLUSTERS;
+    if (clusterMask == 0) return TG_ERR_INVALID;
+
+    for (uint32_t i = 0; i < graph->numTasks; i++) {
+        tgTask_t *t = &graph->tasks[i];
+        t->pendingPreds = t->numPreds;
+        t->state = (t->numPreds == 0) ? TG_TASK_READY : TG_TASK_WAITING;
+        t->cluster = -1;
+        t->doneSeq = 0;
+        t->retVal = 0;
+    }
+
+    setupInterruptHandler(clearSoftInterrupt);
+    for (int32_t c = 0; c < _chimera_numClusters; c++) {
+        running[c] = -1;
+        if (clusterMask & (1 << c)) {
+            setClusterReset(regPtr, c, 0);
+            setClusterClockGating(regPtr, c, 0);
+        }
+    }
+
+    while (numDone < graph->numTasks) {
+        // Retire completed tasks and release their successors
+        for (int32_t c = 0; c < _chimera_numClusters; c++) {
+            uint32_t ret;
+            if (running[c] < 0 || !pollCluster(c, &ret)) continue;
+
+            tgTask_t *t = &graph->tasks[running[c]];
+            t->retVal = tgSlots[c].retVal;
+            t->state = TG_TASK_DONE;
+            t->doneSeq = ++doneSeq;
+            running[c] = -1;
+            numRunning--;
+            numDone++;
+
+            if (t->retVal != 0) status = TG_ERR_KERNEL;
+
+            for (uint32_t s = 0; s < t->numSuccs; s++) {
+                tgTask_t *succ = &graph->tasks[t->succs[s]];
+                if (--succ->pendingPreds == 0) succ->state = TG_TASK_READY;
+            }
+        }
+
+        if (status != TG_OK) {
+            if (numRunning == 0) return status;
+            continue;
+        }
+
+        // Start ready tasks in insertion order on the best idle cluster
+        bool anyReady = false;
+        for (uint32_t i = 0; i < graph->numTasks; i++) {
+            tgTask_t *t = &graph->tasks[i];
+            if (t->state != TG_TASK_READY) continue;
+            anyReady = true;
+
+            int32_t cluster = tgPickCluster(graph, t, running, clusterMask);
+            if (cluster < 0) break;
+
+            tgDispatch(t, cluster);
+            running[cluster] = i;
+            numRunning++;
+        }
+
+        if (!anyReady && numRunning == 0 && numDone < graph->numTasks) {
+            return TG_ERR_CYCLE;
+        }
+    }
+
+    return status;
+}
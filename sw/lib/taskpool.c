@@ -0,0 +1,174 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+#include "taskpool.h"
+#include "offload.h"
+#include "regs/soc_ctrl.h"
+#include "soc_addr_map.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define MSTATUS_MIE 0x00000008
+
+// Lives in the memory island, shared between the host and all workers
+static volatile tpPool_t tpPool;
+
+/* Atomic fetch-and-add over the narrow port (amoadd.w.aqrl) */
+static inline uint32_t tpAmoAdd(volatile uint32_t *addr, uint32_t val) {
+    uint32_t old;
+    asm volatile(".insn r 0x2f, 2, 3, %0, %1, %2\n"
+                 : "=r"(old)
+                 : "r"(addr), "r"(val)
+                 : "memory");
+    return old;
+}
+
+/* Clears the software interrupt of the calling hart, as the trap handler would */
+static inline void tpClearSoftInterrupt() {
+    uint32_t hartId;
+    asm volatile("csrr %0, mhartid" : "=r"(hartId));
+    *(((volatile uint32_t *)CLINT_CTRL_BASE) + hartId) = 0;
+}
+
+/* Runs on the cluster: waits until the host has filled the slot for `ticket`. Sleeps
+ * in wfi once spinning did not help. Interrupts are masked, so a wake-up raised
+ * after the final check leaves MSIP pending and wfi falls through; the worker then
+ * clears MSIP itself instead of taking the trap. */
+static void tpWaitSlot(volatile tpSlot_t *slot, uint32_t ticket, uint32_t clusterId) {
+    for (uint32_t i = 0; i < TP_SPIN_ITERS; i++) {
+        if (slot->seq == ticket + 1) return;
+    }
+
+    while (slot->seq != ticket + 1) {
+        tpPool.sleepTicket[clusterId] = ticket + 1;
+        asm volatile("fence" ::: "memory");
+        if (slot->seq != ticket + 1) {
+            asm volatile("wfi");
+        }
+        tpPool.sleepTicket[clusterId] = 0;
+        tpClearSoftInterrupt();
+    }
+}
+
+/* Runs on the cluster: claim a ticket, wait for its task, run it, repeat until a
+ * stop task is received */
+static int32_t tpWorker() {
+    uint32_t clusterId = getClusterId();
+
+    // The bootrom's trap handler saves no registers, so no interrupt may be taken
+    // inside the worker. The bootrom starts kernels with interrupts masked already.
+    asm volatile("csrc mstatus, %0" ::"r"(MSTATUS_MIE));
+
+    while (1) {
+        uint32_t ticket = tpAmoAdd(&tpPool.head, 1);
+        volatile tpSlot_t *slot = &tpPool.slots[ticket % TP_NUM_SLOTS];
+
+        tpWaitSlot(slot, ticket, clusterId);
+
+        tpKernel_t kernel = slot->kernel;
+        void *arg = slot->arg;
+        asm volatile("fence" ::: "memory");
+        slot->seq = 0;
+
+        if (kernel == NULL) {
+            return 0;
+        }
+
+        if (kernel(arg) != 0) {
+            tpAmoAdd(&tpPool.errors, 1);
+        }
+        tpAmoAdd(&tpPool.done, 1);
+    }
+}
+
+static void tpEnqueue(tpKernel_t kernel, void *arg) {
+    uint32_t ticket = tpPool.tail;
+    volatile tpSlot_t *slot = &tpPool.slots[ticket % TP_NUM_SLOTS];
+
+    // Wait for the worker holding the previous ticket of this slot to take its task
+    while (slot->seq != 0) {
+    }
+
+    slot->kernel = kernel;
+    slot->arg = arg;
+    asm volatile("fence" ::: "memory");
+    slot->seq = ticket + 1;
+    tpPool.tail = ticket + 1;
+    asm volatile("fence" ::: "memory");
+
+    // Only the worker sleeping on this ticket needs to be woken up
+    for (uint8_t c = 0; c < _chimera_numClusters; c++) {
+        if ((tpPool.clusterMask & (1 << c)) && tpPool.sleepTicket[c] == ticket + 1) {
+            volatile uint32_t *interruptTarget =
+                ((uint32_t *)CLINT_CTRL_BASE) + getClusterHartId(c);
+            *interruptTarget = 1;
+        }
+    }
+}
+
+/* Starts a worker on core 0 of every cluster in clusterMask. The workers stay
+ * resident until tpStop. */
+void tpStart(uint8_t clusterMask) {
+    uint8_t *regPtr = (uint8_t *)SOC_CTRL_BASE;
+
+    for (uint32_t i = 0; i < TP_NUM_SLOTS; i++) {
+        tpPool.slots[i].seq = 0;
+    }
+    tpPool.head = 0;
+    tpPool.tail = 0;
+    tpPool.pushed = 0;
+    tpPool.done = 0;
+    tpPool.errors = 0;
+    for (uint8_t c = 0; c < _chimera_numClusters; c++) {
+        tpPool.sleepTicket[c] = 0;
+    }
+    tpPool.clusterMask = clusterMask & ((1 << _chimera_numClusters) - 1);
+
+    setupInterruptHandler(clearSoftInterrupt);
+    for (uint8_t c = 0; c < _chimera_numClusters; c++) {
+        if (tpPool.clusterMask & (1 << c)) {
+            setClusterReset(regPtr, c, 0);
+            setClusterClockGating(regPtr, c, 0);
+            offloadToCluster(tpWorker, c);
+        }
+    }
+}
+
+/* Enqueues a task; blocks only while the queue is full */
+void tpPush(tpKernel_t kernel, void *arg) {
+    if (kernel == NULL) return;
+
+    tpPool.pushed++;
+    tpEnqueue(kernel, arg);
+}
+
+/* Waits until all pushed tasks have completed and returns how many of them failed */
+uint32_t tpWait() {
+    while (tpPool.done != tpPool.pushed) {
+    }
+    return tpPool.errors;
+}
+
+/* Drains the queue, sends every worker back to the bootrom and returns the number
+ * of failed tasks */
+uint32_t tpStop() {
+    uint32_t errors = tpWait();
+
+    for (uint8_t c = 0; c < _chimera_numClusters; c++) {
+        if (tpPool.clusterMask & (1 << c)) {
+            tpEnqueue(NULL, NULL);
+        }
+    }
+    for (uint8_t c = 0; c < _chimera_numClusters; c++) {
+        if (tpPool.clusterMask & (1 << c)) {
+            waitForCluster(c);
+        }
+    }
+
+    tpPool.clusterMask = 0;
+    return errors;
+}
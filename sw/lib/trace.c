@@ -0,0 +1,120 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+#include "trace.h"
+#include "offload.h"
+#include "regs/soc_ctrl.h"
+#include "soc_addr_map.h"
+#include <stdint.h>
+#include <stdio.h>
+
+// Lives in the memory island, written by all harts
+volatile traceRing_t traceRings[TRACE_NUM_RINGS];
+
+// Consumer state, private to the host
+static uint32_t traceTail[TRACE_NUM_RINGS];
+static uint32_t traceLostCnt[TRACE_NUM_RINGS];
+
+/* Empties all rings and enables the events of the offload library and the bootrom.
+ * Must run before any hart emits events. */
+void traceInit() {
+    volatile uint32_t *traceAddr =
+        (volatile uint32_t *)(SOC_CTRL_BASE + CHIMERA_SNITCH_TRACE_ADDR_REG_OFFSET);
+
+    for (uint32_t r = 0; r < TRACE_NUM_RINGS; r++) {
+        for (uint32_t i = 0; i < TRACE_RING_ENTRIES; i++) {
+            traceRings[r].entries[i].seq = 0;
+        }
+        traceRings[r].head = 0;
+        traceTail[r] = 0;
+        traceLostCnt[r] = 0;
+    }
+    asm volatile("fence" ::: "memory");
+    *traceAddr = (uint32_t)traceRings;
+}
+
+/* Copies up to maxRecords new events into records, ring by ring and in order within
+ * each ring, and returns their number. Never waits for producers: an entry that is
+ * still being written is left for the next call. */
+uint32_t traceDrain(traceRecord_t *records, uint32_t maxRecords) {
+    uint32_t count = 0;
+
+    for (uint32_t r = 0; r < TRACE_NUM_RINGS; r++) {
+        volatile traceRing_t *ring = &traceRings[r];
+        uint32_t tail = traceTail[r];
+        uint32_t head = ring->head;
+
+        // Entries older than one lap have been overwritten
+        if (head - tail > TRACE_RING_ENTRIES) {
+            traceLostCnt[r] += head - tail - TRACE_RING_ENTRIES;
+            tail = head - TRACE_RING_ENTRIES;
+        }
+
+        while (tail != head && count < maxRecords) {
+            volatile traceEntry_t *entry = &ring->entries[tail % TRACE_RING_ENTRIES];
+            uint32_t seq = entry->seq;
+            int32_t lag = (int32_t)(seq - (tail + 1));
+
+            // Claimed but not written yet
+            if (seq == 0 || lag < 0) break;
+
+            traceRecord_t *rec = &records[count];
+            uint32_t info = entry->info;
+            rec->timestamp = entry->timestamp;
+            rec->arg = entry->arg;
+
+            // Overwritten by a later lap, possibly while it was being copied
+            if (lag > 0 || entry->seq != seq) {
+                traceLostCnt[r]++;
+                tail++;
+                continue;
+            }
+
+            rec->seq = seq - 1;
+            rec->event = info >> 16;
+            rec->hart = info & 0xff;
+            rec->ring = r;
+            count++;
+            tail++;
+        }
+
+        traceTail[r] = tail;
+    }
+
+    return count;
+}
+
+/* Returns the number of events of a ring that were overwritten before being drained */
+uint32_t traceLost(uint8_t ring) {
+    return traceLostCnt[ring];
+}
+
+/* Drains all rings and prints one line per event for scripts/trace_decode.py.
+ * Returns the number of events printed. */
+uint32_t traceDump() {
+    traceRecord_t records[16];
+    uint32_t total = 0;
+    uint32_t count;
+
+    do {
+        count = traceDrain(records, sizeof(records) / sizeof(records[0]));
+        for (uint32_t i = 0; i < count; i++) {
+            printf("TRACE %x %x %x %x %x %x\n", (unsigned)records[i].ring,
+                   (unsigned)records[i].hart, (unsigned)records[i].event,
+                   (unsigned)records[i].seq, (unsigned)records[i].timestamp,
+                   (unsigned)records[i].arg);
+        }
+        total += count;
+    } while (count != 0);
+
+    for (uint32_t r = 0; r < TRACE_NUM_RINGS; r++) {
+        if (traceLostCnt[r] != 0) {
+            printf("TRACE-LOST %x %x\n", (unsigned)r, (unsigned)traceLostCnt[r]);
+        }
+    }
+
+    return total;
+}
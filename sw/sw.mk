@@ -33,6 +33,16 @@ $(CHIM_SW_DIR)/lib/libchimera.a: $(CHIM_SW_LIB_SRCS_O)
 CHIM_SW_TEST_SRCS_S 	 	= $(wildcard $(CHIM_SW_DIR)/tests/*.S)
 CHIM_SW_TEST_SRCS_C     	= $(wildcard $(CHIM_SW_DIR)/tests/*.c)
 
+# Code relocated into cluster TCDM (CLUSTER_TEXT) must reach globals at their absolute
+# addresses instead of relative to the PC as with Cheshire's medany model. Only the
+# objects holding CLUSTER_TEXT code are built with medlow, which covers the whole
+# RV32 address space; they are kept out of LTO so the link does not recompile them
+# with the default model.
+CHIM_SW_CLUSTER_TEXT_SRCS = $(CHIM_SW_DIR)/tests/testClusterRelocation.c
+CHIM_SW_CLUSTER_TEXT_FLAGS = -mcmodel=medlow -fno-lto
+
+$(CHIM_SW_CLUSTER_TEXT_SRCS:.c=.o): CHS_SW_CCFLAGS += $(CHIM_SW_CLUSTER_TEXT_FLAGS)
+
 CHIM_SW_TEST_MEMISL_DUMP = $(CHIM_SW_TEST_SRCS_S:.S=.memisl.dump)  $(CHIM_SW_TEST_SRCS_C:.c=.memisl.dump)
 
 CHIM_SW_TESTS += $(CHIM_SW_TEST_MEMISL_DUMP)
@@ -0,0 +1,140 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Bank-aware allocation test. The DMA cores of two clusters gather every other
+// bank-wide chunk of a memory island buffer into their TCDM at the same time, so
+// each stream stays within the bank its buffer starts in. Buffers placed in the
+// same bank make the streams collide; the arena's bank hints separate them and
+// must make the gathers at least 1/8 faster. Also checks alignment and free list
+// reuse.
+
+#include "arena.h"
+#include "offload.h"
+#include "soc_addr_map.h"
+#include <regs/soc_ctrl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define NUM_CHUNKS 64
+#define CHUNK_SIZE MEMISL_BANK_WIDTH
+#define CHUNK_STRIDE (MEMISL_NUM_BANKS * MEMISL_BANK_WIDTH)
+#define BUFFER_SIZE ((NUM_CHUNKS - 1) * CHUNK_STRIDE + CHUNK_SIZE)
+
+#define CLUSTER_A 0
+#define CLUSTER_B 1
+
+typedef struct {
+    uint32_t src;
+    uint32_t cycles;
+    uint32_t ready;
+    uint32_t done;
+} gatherSlot_t;
+
+static arena_t arena;
+static volatile gatherSlot_t gatherSlots[_chimera_numClusters];
+static volatile uint32_t gatherGo;
+
+/* Runs on the DMA core: waits for the start signal, then gathers the chunks */
+int32_t gatherDma() {
+    uint32_t start, end;
+
+    uint32_t clusterId = getClusterId();
+    volatile gatherSlot_t *slot = &gatherSlots[clusterId];
+    uint32_t dst = _chimera_clusterBase[clusterId];
+
+    slot->ready = 1;
+    while (gatherGo == 0) {
+    }
+
+    asm volatile("csrr %0, mcycle" : "=r"(start));
+    clusterDmaStart2d(dst, slot->src, CHUNK_SIZE, CHUNK_SIZE, CHUNK_STRIDE, NUM_CHUNKS);
+    clusterDmaWait();
+    asm volatile("csrr %0, mcycle" : "=r"(end));
+
+    slot->cycles = end - start;
+    slot->done = 1;
+    return 0;
+}
+
+/* Gathers srcA into cluster A and srcB into cluster B concurrently and returns the
+ * sum of both transfer times in cluster cycles */
+static uint32_t runGather(uint8_t *srcA, uint8_t *srcB) {
+    uint8_t clusters[2] = {CLUSTER_A, CLUSTER_B};
+
+    gatherGo = 0;
+    gatherSlots[CLUSTER_A].src = (uint32_t)srcA;
+    gatherSlots[CLUSTER_B].src = (uint32_t)srcB;
+
+    for (int i = 0; i < 2; i++) {
+        gatherSlots[clusters[i]].ready = 0;
+        gatherSlots[clusters[i]].done = 0;
+        offloadToDmaCore(gatherDma, clusters[i]);
+    }
+
+    // Start both gathers together
+    while (gatherSlots[CLUSTER_A].ready == 0 || gatherSlots[CLUSTER_B].ready == 0) {
+    }
+    gatherGo = 1;
+
+    while (gatherSlots[CLUSTER_A].done == 0 || gatherSlots[CLUSTER_B].done == 0) {
+    }
+
+    return gatherSlots[CLUSTER_A].cycles + gatherSlots[CLUSTER_B].cycles;
+}
+
+static int checkGather(uint8_t clusterId, uint8_t *src) {
+    volatile uint8_t *tcdm = (volatile uint8_t *)_chimera_clusterBase[clusterId];
+    for (uint32_t i = 0; i < NUM_CHUNKS; i++) {
+        for (uint32_t j = 0; j < CHUNK_SIZE; j++) {
+            if (tcdm[i * CHUNK_SIZE + j] != src[i * CHUNK_STRIDE + j]) return 1;
+        }
+    }
+    return 0;
+}
+
+int main() {
+    volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
+    setupInterruptHandler(clearSoftInterrupt);
+
+    if (arenaInitMemIsland(&arena) != ARENA_OK) return 1;
+
+    uint8_t *srcA = arenaAlloc(&arena, BUFFER_SIZE, 0, 0);
+    uint8_t *srcB = arenaAlloc(&arena, BUFFER_SIZE, 0, 0);
+    uint8_t *srcC = arenaAlloc(&arena, BUFFER_SIZE, 0, 1);
+    if (srcA == NULL || srcB == NULL || srcC == NULL) return 2;
+    if (arenaBankOf(&arena, srcA) != 0 || arenaBankOf(&arena, srcB) != 0 ||
+        arenaBankOf(&arena, srcC) != 1) {
+        return 3;
+    }
+
+    // Alignment hints and constant-time reuse of freed blocks
+    void *aligned = arenaAlloc(&arena, 100, 1024, ARENA_ANY_BANK);
+    if (aligned == NULL || ((uint32_t)aligned & 1023) != 0) return 4;
+    if (arenaFree(&arena, aligned) != ARENA_OK) return 5;
+    if (arenaFree(&arena, aligned) != ARENA_ERR_INVALID) return 6;
+    if (arenaAlloc(&arena, 100, 1024, ARENA_ANY_BANK) != aligned) return 7;
+
+    for (uint32_t i = 0; i < BUFFER_SIZE; i++) {
+        srcA[i] = i;
+        srcB[i] = i ^ 0x55;
+        srcC[i] = i ^ 0xAA;
+    }
+
+    setClusterReset(regPtr, CLUSTER_A, 0);
+    setClusterReset(regPtr, CLUSTER_B, 0);
+    setClusterClockGating(regPtr, CLUSTER_A, 0);
+    setClusterClockGating(regPtr, CLUSTER_B, 0);
+
+    uint32_t sameBankCycles = runGather(srcA, srcB);
+    if (checkGather(CLUSTER_A, srcA) || checkGather(CLUSTER_B, srcB)) return 8;
+
+    uint32_t splitBankCycles = runGather(srcA, srcC);
+    if (checkGather(CLUSTER_A, srcA) || checkGather(CLUSTER_B, srcC)) return 9;
+
+    setAllClusterClockGating(regPtr, 1);
+
+    return 8 * splitBankCycles > 7 * sameBankCycles;
+}
@@ -0,0 +1,100 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// DMA bandwidth sweep over the cluster wide path. The DMA core of cluster 0
+// copies a buffer from the memory island into its TCDM, issuing an increasing
+// number of transfers back-to-back before waiting for completion. Issue depths
+// beyond the transfers the hardware keeps in flight (CluDmaNumAxInFlight: 3 with
+// SELCFG=0, 16 with SELCFG=2) stop paying off, so the printed cycles per depth
+// show where the configured hardware depth saturates. CI runs the test on both
+// configurations. Keeping several transfers in flight must hide most of the
+// memory latency: the deepest issue has to be at least 25% faster than fully
+// serialized transfers.
+
+#include "console.h"
+#include "offload.h"
+#include "soc_addr_map.h"
+#include <regs/soc_ctrl.h>
+#include <stdint.h>
+
+#define DMA_CLUSTER 0
+#define DMA_DST CLUSTER_0_BASE
+
+#define CHUNK_SIZE 256
+#define NUM_CHUNKS 16
+#define BUF_SIZE (CHUNK_SIZE * NUM_CHUNKS)
+
+#define NUM_DEPTHS 6
+
+static const uint32_t dmaDepths[NUM_DEPTHS] = {1, 2, 3, 4, 8, 16};
+
+static uint8_t __attribute__((section(".bulk"), aligned(64))) dmaSrc[BUF_SIZE];
+
+volatile uint32_t dmaDepth;
+volatile uint32_t dmaDone;
+volatile uint32_t dmaCycles[NUM_DEPTHS];
+
+// Runs on the DMA core: issue `dmaDepth` chunks, wait, repeat until the buffer is copied
+int32_t dmaSweepKernel() {
+    uint32_t start, end;
+    uint32_t depth = dmaDepth;
+
+    asm volatile("csrr %0, mcycle" : "=r"(start)::);
+    for (uint32_t chunk = 0; chunk < NUM_CHUNKS; chunk += depth) {
+        for (uint32_t i = chunk; i < chunk + depth && i < NUM_CHUNKS; i++) {
+            clusterDmaStart1d(DMA_DST + i * CHUNK_SIZE, (uint32_t)dmaSrc + i * CHUNK_SIZE,
+                              CHUNK_SIZE);
+        }
+        clusterDmaWait();
+    }
+    asm volatile("csrr %0, mcycle" : "=r"(end)::);
+
+    dmaDone = end - start;
+    return 0;
+}
+
+int main() {
+    volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
+    volatile uint8_t *dstPtr = (volatile uint8_t *)DMA_DST;
+
+    for (int i = 0; i < BUF_SIZE; i++) {
+        dmaSrc[i] = (uint8_t)i;
+    }
+
+    setClusterReset(regPtr, DMA_CLUSTER, 0);
+    setClusterClockGating(regPtr, DMA_CLUSTER, 0);
+    setupInterruptHandler(clearSoftInterrupt);
+    consoleInit();
+
+    for (int d = 0; d < NUM_DEPTHS; d++) {
+        dmaDepth = dmaDepths[d];
+        dmaDone = 0;
+
+        offloadToDmaCore(dmaSweepKernel, DMA_CLUSTER);
+        while (dmaDone == 0) {
+        }
+        dmaCycles[d] = dmaDone;
+
+        printf("DMA depth %2u: %6u cycles, %4u bytes/kcycle\n", (unsigned)dmaDepths[d],
+               (unsigned)dmaCycles[d], (unsigned)(BUF_SIZE * 1000 / dmaCycles[d]));
+
+        for (int i = 0; i < BUF_SIZE; i++) {
+            if (dstPtr[i] != (uint8_t)i) {
+                return 1 + d;
+            }
+            dstPtr[i] = 0;
+        }
+    }
+
+    setClusterClockGating(regPtr, DMA_CLUSTER, 1);
+
+    // The deepest issue must clearly beat fully serialized transfers
+    if (4 * dmaCycles[NUM_DEPTHS - 1] > 3 * dmaCycles[0]) {
+        return 0x10;
+    }
+
+    return 0;
+}
@@ -6,8 +6,9 @@
 // Viviane Potocnik <vivianep@iis.ee.ethz.ch>
 
 // Simple offload test. Set the trap handler first, offload a function, retrieve
-// return value from cluster. Does not currently take care of stack
-// initialization and bss initialization on cluster.
+// return value from cluster. Also checks that the bootrom set up the stack of
+// core 0 in the cluster's TCDM. Does not currently take care of bss
+// initialization on cluster.
 
 #include "offload.h"
 #include "soc_addr_map.h"
@@ -31,6 +32,18 @@ int32_t testReturn() {
     return TESTVAL;
 }
 
+/* Returns TESTVAL if the stack pointer lies in the stack of core 0 of this cluster */
+int32_t testStack() {
+    uint32_t sp;
+    asm volatile("mv %0, sp" : "=r"(sp));
+
+    uint32_t top = _chimera_clusterBase[getClusterId()] + CLUSTER_TEXT_OFFSET;
+    if (sp > top || sp <= top - CLUSTER_STACK_SIZE) {
+        return 0;
+    }
+    return TESTVAL;
+}
+
 int main() {
     volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
     setupInterruptHandler(clusterTrapHandler);
@@ -41,6 +54,10 @@ int main() {
         setClusterClockGating(regPtr, i, 0);
         offloadToCluster(testReturn, i);
         retVal |= waitForCluster(i);
+        offloadToCluster(testStack, i);
+        if (waitForCluster(i) != (TESTVAL | 0x000000001)) {
+            return 2;
+        }
         setClusterClockGating(regPtr, i, 1);
         setClusterReset(regPtr, i, 0);
     }
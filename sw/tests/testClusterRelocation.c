@@ -0,0 +1,91 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Kernel relocation test. The same kernel runs from the memory island and from a
+// copy in the TCDM of cluster 0. The relocated copy is pre-warmed, which must not
+// run the kernel. Each variant runs twice and the second, I-cache warm run is
+// timed. The kernel only overwrites its results, so running it again
+// is harmless. Both must produce the same result, and the relocated run must not
+// be slower. The kernel calls mix, so it spills to the cluster stack and checks
+// that calls between relocated functions stay valid.
+
+#include "offload.h"
+#include "relocate.h"
+#include "soc_addr_map.h"
+#include <regs/soc_ctrl.h>
+#include <stdint.h>
+
+#define TEST_CLUSTER 0
+#define NUM_ELEMS 256
+
+volatile uint32_t data[NUM_ELEMS];
+volatile uint32_t checksum;
+volatile uint32_t kernelCycles;
+
+CLUSTER_TEXT uint32_t mix(uint32_t acc, uint32_t val) {
+    return (acc << 5) + acc + (val ^ (acc >> 3));
+}
+
+CLUSTER_TEXT int32_t checksumKernel() {
+    uint32_t start, end;
+    uint32_t acc = 5381;
+
+    asm volatile("csrr %0, mcycle" : "=r"(start)::);
+    for (uint32_t i = 0; i < NUM_ELEMS; i++) {
+        acc = mix(acc, data[i]);
+    }
+    asm volatile("csrr %0, mcycle" : "=r"(end)::);
+
+    checksum = acc;
+    kernelCycles = end - start;
+    return 0;
+}
+
+int main() {
+    volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
+
+    for (uint32_t i = 0; i < NUM_ELEMS; i++) {
+        data[i] = i * 2654435761u;
+    }
+
+    setClusterReset(regPtr, TEST_CLUSTER, 0);
+    setClusterClockGating(regPtr, TEST_CLUSTER, 0);
+
+    // Reference runs from the memory island
+    setupInterruptHandler(clearSoftInterrupt);
+    for (int run = 0; run < 2; run++) {
+        offloadToCluster(checksumKernel, TEST_CLUSTER);
+        waitForCluster(TEST_CLUSTER);
+    }
+    uint32_t refChecksum = checksum;
+    uint32_t refCycles = kernelCycles;
+
+    if (relocateToCluster(TEST_CLUSTER) != 0) {
+        return 1;
+    }
+
+    checksum = 0;
+    if (prewarmRelocated(TEST_CLUSTER) != 0 || checksum != 0) {
+        return 4;
+    }
+
+    for (int run = 0; run < 2; run++) {
+        checksum = 0;
+        offloadRelocated(checksumKernel, TEST_CLUSTER);
+        waitForCluster(TEST_CLUSTER);
+    }
+
+    setClusterClockGating(regPtr, TEST_CLUSTER, 1);
+
+    if (checksum != refChecksum) {
+        return 2;
+    }
+    if (kernelCycles > refCycles) {
+        return 3;
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Multicast test. A table is broadcast to the TCDMs of clusters 0, 2 and 4 with
+// DMA bursts; clusters 1 and 3 must remain untouched. The broadcast is timed
+// against storing the table word by word to the window, where each store is a
+// separate multicast transaction; the bursts must be at least twice as fast.
+// Broadcasting to a clock-gated cluster must be refused.
+
+#include "console.h"
+#include "multicast.h"
+#include "offload.h"
+#include "soc_addr_map.h"
+#include <regs/soc_ctrl.h>
+#include <stdint.h>
+
+#define TABLE_WORDS 256
+#define TABLE_OFFSET 0x1000
+#define CLUSTER_MASK 0x15
+#define GATED_CLUSTER 1
+
+static uint32_t table[TABLE_WORDS];
+
+static void clearTables() {
+    for (int c = 0; c < _chimera_numClusters; c++) {
+        volatile uint32_t *tcdm = (volatile uint32_t *)(_chimera_clusterBase[c] + TABLE_OFFSET);
+        for (uint32_t i = 0; i < TABLE_WORDS; i++) {
+            tcdm[i] = 0;
+        }
+    }
+}
+
+static int checkTables() {
+    for (int c = 0; c < _chimera_numClusters; c++) {
+        volatile uint32_t *tcdm = (volatile uint32_t *)(_chimera_clusterBase[c] + TABLE_OFFSET);
+        uint32_t expectWritten = (CLUSTER_MASK >> c) & 1;
+        for (uint32_t i = 0; i < TABLE_WORDS; i++) {
+            if (tcdm[i] != (expectWritten ? table[i] : 0)) {
+                return 1 + c;
+            }
+        }
+    }
+    return 0;
+}
+
+int main() {
+    volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
+    uint32_t start, end, burstCycles, wordCycles;
+    int err;
+
+    consoleInit();
+
+    for (uint32_t i = 0; i < TABLE_WORDS; i++) {
+        table[i] = 0xCAFE0000 | i;
+    }
+
+    for (int c = 0; c < _chimera_numClusters; c++) {
+        setClusterReset(regPtr, c, 0);
+        setClusterClockGating(regPtr, c, 0);
+    }
+    clearTables();
+
+    asm volatile("csrr %0, mcycle" : "=r"(start)::"memory");
+    if (broadcastToClusters(CLUSTER_MASK, TABLE_OFFSET, table, sizeof(table)) != MULTICAST_OK) {
+        return 0x10;
+    }
+    asm volatile("csrr %0, mcycle" : "=r"(end)::"memory");
+    burstCycles = end - start;
+    if ((err = checkTables()) != 0) return err;
+
+    clearTables();
+    volatile uint32_t *window = (volatile uint32_t *)MULTICAST_ADDR(CLUSTER_MASK, TABLE_OFFSET);
+    asm volatile("csrr %0, mcycle" : "=r"(start)::"memory");
+    for (uint32_t i = 0; i < TABLE_WORDS; i++) {
+        window[i] = table[i];
+    }
+    asm volatile("fence" ::: "memory");
+    asm volatile("csrr %0, mcycle" : "=r"(end)::"memory");
+    wordCycles = end - start;
+    if ((err = checkTables()) != 0) return 0x20 + err;
+
+    printf("Multicast of %u bytes: %u cycles as DMA bursts, %u cycles as word stores\n",
+           (unsigned)sizeof(table), (unsigned)burstCycles, (unsigned)wordCycles);
+    if (2 * burstCycles > wordCycles) return 0x30;
+
+    // A gated cluster would never accept the write
+    setClusterClockGating(regPtr, GATED_CLUSTER, 1);
+    if (broadcastToClusters(1 << GATED_CLUSTER, TABLE_OFFSET, table, sizeof(table)) !=
+        MULTICAST_ERR_INACTIVE) {
+        return 0x40;
+    }
+
+    setAllClusterClockGating(regPtr, 1);
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Sequential narrow accesses from a cluster core to the memory island. Exercises
+// the access patterns the narrow coalescer merges (word and byte streams) and the
+// ones it must not break (read-after-write, data updated by the host between
+// offloads, data rewritten by the cluster DMA between two sequential reads). Run
+// with SELCFG=2 to enable coalescing; the result must not change.
+
+#include "offload.h"
+#include "soc_addr_map.h"
+#include <regs/soc_ctrl.h>
+#include <stdint.h>
+
+#define TEST_CLUSTER 0
+#define NUM_WORDS 64
+#define LINE_WORDS 16 // One coalescer line
+
+typedef struct {
+    uint32_t ready;
+    uint32_t go;
+    uint32_t done;
+} crossFlags_t;
+
+volatile uint32_t wordBuf[NUM_WORDS] __attribute__((aligned(64)));
+volatile uint32_t lineBuf[LINE_WORDS] __attribute__((aligned(64)));
+volatile uint32_t lineSrc[LINE_WORDS] __attribute__((aligned(64)));
+volatile uint32_t seed;
+
+// Handshake between the two cores of the cluster, kept in TCDM to stay off the
+// narrow path under test
+static volatile crossFlags_t *crossFlags(uint32_t clusterId) {
+    return (volatile crossFlags_t *)_chimera_clusterBase[clusterId];
+}
+
+// Word stream out, byte stream over the upper half, then read back in order
+int32_t streamKernel() {
+    volatile uint8_t *byteBuf = (volatile uint8_t *)wordBuf;
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < NUM_WORDS; i++) {
+        wordBuf[i] = seed + i;
+    }
+    for (uint32_t i = 2 * NUM_WORDS; i < 4 * NUM_WORDS; i++) {
+        byteBuf[i] = (uint8_t)(seed ^ i);
+    }
+    for (uint32_t i = 0; i < NUM_WORDS / 2; i++) {
+        errors += (wordBuf[i] != seed + i);
+    }
+    for (uint32_t i = 2 * NUM_WORDS; i < 4 * NUM_WORDS; i++) {
+        errors += (byteBuf[i] != (uint8_t)(seed ^ i));
+    }
+
+    // Interleaved read-modify-write: every read must see the preceding write
+    for (uint32_t i = 1; i < NUM_WORDS; i++) {
+        wordBuf[i] = wordBuf[i - 1] + 1;
+    }
+    errors += (wordBuf[NUM_WORDS - 1] != wordBuf[0] + NUM_WORDS - 1);
+
+    return errors << 1;
+}
+
+// Read the buffer in order; the host has changed it since the last kernel ran
+int32_t readKernel() {
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < NUM_WORDS; i++) {
+        errors += (wordBuf[i] != ~(seed + i));
+    }
+
+    return errors << 1;
+}
+
+// Runs on the DMA core: rewrites the line over the wide path while core 0 reads it
+int32_t lineDmaKernel() {
+    volatile crossFlags_t *flags = crossFlags(getClusterId());
+
+    flags->ready = 1;
+    while (flags->go == 0) {
+    }
+    clusterDmaStart1d((uint32_t)&lineBuf[2], (uint32_t)&lineSrc[2], (LINE_WORDS - 2) * 4);
+    // Also flushes the coalescer of this cluster
+    clusterDmaWait();
+    flags->done = 1;
+
+    return 0;
+}
+
+// Two sequential reads start a read-ahead of the line; the rest of the line is read
+// after the DMA core has rewritten it and must not come from the read-ahead
+int32_t lineReadKernel() {
+    volatile crossFlags_t *flags = crossFlags(getClusterId());
+    uint32_t errors = 0;
+
+    errors += (lineBuf[0] != seed);
+    errors += (lineBuf[1] != seed + 1);
+    flags->go = 1;
+    while (flags->done == 0) {
+    }
+    for (uint32_t i = 2; i < LINE_WORDS; i++) {
+        errors += (lineBuf[i] != ~(seed + i));
+    }
+
+    return errors << 1;
+}
+
+int main() {
+    volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
+    uint32_t retVal = 0;
+
+    setupInterruptHandler(clearSoftInterrupt);
+    setClusterReset(regPtr, TEST_CLUSTER, 0);
+    setClusterClockGating(regPtr, TEST_CLUSTER, 0);
+
+    for (uint32_t iter = 0; iter < 2; iter++) {
+        seed = 0x1000 * (iter + 1);
+
+        offloadToCluster(streamKernel, TEST_CLUSTER);
+        retVal |= waitForCluster(TEST_CLUSTER);
+
+        // Cluster writes must be visible to the host once the kernel has returned
+        for (uint32_t i = 0; i < NUM_WORDS; i++) {
+            if (wordBuf[i] != wordBuf[0] + i) {
+                return 2;
+            }
+            wordBuf[i] = ~(seed + i);
+        }
+
+        offloadToCluster(readKernel, TEST_CLUSTER);
+        retVal |= waitForCluster(TEST_CLUSTER);
+
+        for (uint32_t i = 0; i < LINE_WORDS; i++) {
+            lineBuf[i] = seed + i;
+            lineSrc[i] = ~(seed + i);
+        }
+        volatile crossFlags_t *flags = crossFlags(TEST_CLUSTER);
+        flags->ready = 0;
+        flags->go = 0;
+        flags->done = 0;
+
+        // Core 0 starts once the DMA kernel waits for go
+        offloadToDmaCore(lineDmaKernel, TEST_CLUSTER);
+        while (flags->ready == 0) {
+        }
+        offloadToCluster(lineReadKernel, TEST_CLUSTER);
+        retVal |= waitForCluster(TEST_CLUSTER);
+    }
+
+    setClusterClockGating(regPtr, TEST_CLUSTER, 1);
+
+    return (retVal != 1);
+}
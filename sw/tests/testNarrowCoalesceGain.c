@@ -0,0 +1,105 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Cycle measurement of the narrow coalescer, run on SELCFG=2 only. Core 0 of a
+// cluster stores and then loads a memory island buffer word by word, once in order
+// and once in a scattered order where no access continues the previous one. The
+// coalescer passes scattered accesses through unchanged, so they cost what every
+// access costs with SELCFG=0. Both orders run the same code, walking an index
+// table in TCDM. In-order loads must be at least 1/8 faster than scattered ones;
+// in-order stores must not be slower.
+
+#include "console.h"
+#include "offload.h"
+#include "soc_addr_map.h"
+#include <regs/soc_ctrl.h>
+#include <stdint.h>
+
+#define TEST_CLUSTER 0
+#define NUM_WORDS 256
+// Coprime with NUM_WORDS and more than a line: successive accesses never merge
+#define SCATTER_STRIDE 17
+
+typedef struct {
+    uint32_t store;
+    uint32_t load;
+} gainCycles_t;
+
+volatile uint32_t gainBuf[NUM_WORDS] __attribute__((aligned(64)));
+volatile uint32_t scattered;
+volatile gainCycles_t gainCycles;
+
+int32_t gainKernel() {
+    volatile uint32_t *index = (volatile uint32_t *)_chimera_clusterBase[getClusterId()];
+    uint32_t start, mid, end;
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < NUM_WORDS; i++) {
+        index[i] = scattered ? (i * SCATTER_STRIDE) % NUM_WORDS : i;
+    }
+
+    asm volatile("csrr %0, mcycle" : "=r"(start)::"memory");
+    for (uint32_t i = 0; i < NUM_WORDS; i++) {
+        gainBuf[index[i]] = i;
+    }
+    asm volatile("fence" ::: "memory");
+    asm volatile("csrr %0, mcycle" : "=r"(mid)::"memory");
+    for (uint32_t i = 0; i < NUM_WORDS; i++) {
+        sum += gainBuf[index[i]];
+    }
+    asm volatile("csrr %0, mcycle" : "=r"(end)::"memory");
+
+    gainCycles.store = mid - start;
+    gainCycles.load = end - mid;
+
+    // Every word was written exactly once with its position in the order
+    return (sum != NUM_WORDS * (NUM_WORDS - 1) / 2) << 1;
+}
+
+/* Runs the kernel twice in the given order and returns the cycles of the warm run */
+static int runGain(uint32_t order, gainCycles_t *cycles) {
+    uint32_t retVal = 0;
+
+    scattered = order;
+    for (int run = 0; run < 2; run++) {
+        offloadToCluster(gainKernel, TEST_CLUSTER);
+        retVal |= waitForCluster(TEST_CLUSTER);
+    }
+    cycles->store = gainCycles.store;
+    cycles->load = gainCycles.load;
+
+    return retVal != 1;
+}
+
+int main() {
+    volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
+    gainCycles_t inOrder, scatter;
+
+    setupInterruptHandler(clearSoftInterrupt);
+    setClusterReset(regPtr, TEST_CLUSTER, 0);
+    setClusterClockGating(regPtr, TEST_CLUSTER, 0);
+    consoleInit();
+
+    if (runGain(0, &inOrder) || runGain(1, &scatter)) {
+        return 1;
+    }
+
+    setClusterClockGating(regPtr, TEST_CLUSTER, 1);
+
+    printf("Coalescer stores: %u cycles in order, %u scattered\n", (unsigned)inOrder.store,
+           (unsigned)scatter.store);
+    printf("Coalescer loads:  %u cycles in order, %u scattered\n", (unsigned)inOrder.load,
+           (unsigned)scatter.load);
+
+    if (inOrder.store > scatter.store) {
+        return 2;
+    }
+    if (8 * inOrder.load > 7 * scatter.load) {
+        return 3;
+    }
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Task-graph scheduler test. A fill task feeds four partial sums that are reduced
+// by a final task, while independent tasks keep the remaining clusters busy. A
+// task reading from cluster 2's TCDM must be placed on cluster 2. Every kernel is
+// called from tgTrampoline and therefore runs on the cluster stack.
+
+#include "offload.h"
+#include "soc_addr_map.h"
+#include "taskgraph.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define NUM_ELEMS 64
+#define NUM_PARTS 4
+#define PART_ELEMS (NUM_ELEMS / NUM_PARTS)
+
+typedef struct {
+    volatile uint32_t *src;
+    volatile uint32_t *dst;
+    uint32_t len;
+} sumArgs_t;
+
+static tgGraph_t graph;
+
+volatile uint32_t data[NUM_ELEMS];
+volatile uint32_t partial[NUM_PARTS];
+volatile uint32_t total;
+volatile uint32_t ranOnCluster;
+
+static sumArgs_t partArgs[NUM_PARTS];
+static sumArgs_t totalArgs = {partial, &total, NUM_PARTS};
+
+int32_t fillKernel(void *arg) {
+    for (uint32_t i = 0; i < NUM_ELEMS; i++) {
+        data[i] = i + 1;
+    }
+    return 0;
+}
+
+int32_t sumKernel(void *arg) {
+    sumArgs_t *args = (sumArgs_t *)arg;
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < args->len; i++) {
+        sum += args->src[i];
+    }
+    *args->dst = sum;
+    return 0;
+}
+
+int32_t localKernel(void *arg) {
+    ranOnCluster = getClusterId();
+    return 0;
+}
+
+int main() {
+    volatile uint32_t *tcdm2 = (volatile uint32_t *)CLUSTER_2_BASE;
+
+    int32_t parts[NUM_PARTS];
+
+    tgInit(&graph);
+
+    // A task needs a kernel; the graph is left unchanged
+    if (tgAddTask(&graph, NULL, NULL) != TG_ERR_INVALID || graph.numTasks != 0) {
+        return 6;
+    }
+
+    int32_t fill = tgAddTask(&graph, fillKernel, NULL);
+    tgAddOutput(&graph, fill, (void *)data, sizeof(data));
+
+    int32_t reduce = tgAddTask(&graph, sumKernel, &totalArgs);
+    tgAddInput(&graph, reduce, (void *)partial, sizeof(partial));
+    tgAddOutput(&graph, reduce, (void *)&total, sizeof(total));
+
+    for (uint32_t p = 0; p < NUM_PARTS; p++) {
+        partArgs[p].src = &data[p * PART_ELEMS];
+        partArgs[p].dst = &partial[p];
+        partArgs[p].len = PART_ELEMS;
+
+        parts[p] = tgAddTask(&graph, sumKernel, &partArgs[p]);
+        tgAddInput(&graph, parts[p], (void *)&data[p * PART_ELEMS], PART_ELEMS * sizeof(uint32_t));
+        tgAddOutput(&graph, parts[p], (void *)&partial[p], sizeof(uint32_t));
+        tgAddDependency(&graph, fill, parts[p]);
+        tgAddDependency(&graph, parts[p], reduce);
+    }
+
+    int32_t local = tgAddTask(&graph, localKernel, NULL);
+    tgAddInput(&graph, local, (void *)tcdm2, 64);
+
+    ranOnCluster = 0xFF;
+    if (tgRun(&graph, TG_ALL_CLUSTERS) != TG_OK) {
+        return 1;
+    }
+
+    if (total != NUM_ELEMS * (NUM_ELEMS + 1) / 2) {
+        return 2;
+    }
+    for (uint32_t p = 0; p < NUM_PARTS; p++) {
+        if (graph.tasks[reduce].doneSeq < graph.tasks[parts[p]].doneSeq) {
+            return 3;
+        }
+    }
+    if (ranOnCluster != 2) {
+        return 4;
+    }
+
+    // A cycle must be reported instead of hanging
+    tgAddDependency(&graph, reduce, fill);
+    if (tgRun(&graph, TG_ALL_CLUSTERS) != TG_ERR_CYCLE) {
+        return 5;
+    }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Self-scheduling task pool test. Workers on all clusters claim a stream of small
+// tasks from the shared queue. A second batch is pushed after the workers went to
+// sleep on the empty queue to exercise the wake-up path.
+
+#include "offload.h"
+#include "soc_addr_map.h"
+#include "taskpool.h"
+#include <stdint.h>
+
+#define NUM_TASKS 160
+#define IDLE_CYCLES 20000
+
+volatile uint32_t results[NUM_TASKS];
+volatile uint8_t ranOn[NUM_TASKS];
+
+int32_t squareKernel(void *arg) {
+    uint32_t idx = (uint32_t)arg;
+    results[idx] = idx * idx;
+    ranOn[idx] = getClusterId();
+    return 0;
+}
+
+static int32_t pushBatch(uint32_t first, uint32_t last) {
+    for (uint32_t i = first; i < last; i++) {
+        results[i] = 0;
+        tpPush(squareKernel, (void *)i);
+    }
+    return tpWait();
+}
+
+int main() {
+    uint32_t clustersUsed = 0;
+
+    tpStart((1 << _chimera_numClusters) - 1);
+
+    if (pushBatch(0, NUM_TASKS / 2) != 0) {
+        return 1;
+    }
+
+    // Let all workers run dry and fall asleep in wfi
+    for (int i = 0; i < IDLE_CYCLES; i++) {
+        asm volatile("addi x0, x0, 0\n" :::);
+    }
+
+    if (pushBatch(NUM_TASKS / 2, NUM_TASKS) != 0) {
+        return 2;
+    }
+
+    if (tpStop() != 0) {
+        return 3;
+    }
+
+    for (uint32_t i = 0; i < NUM_TASKS; i++) {
+        if (results[i] != i * i) {
+            return 4;
+        }
+        clustersUsed |= 1 << ranOn[i];
+    }
+
+    // The stream must have been spread over more than one cluster
+    if ((clustersUsed & (clustersUsed - 1)) == 0) {
+        return 5;
+    }
+
+    return 0;
+}
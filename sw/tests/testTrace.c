@@ -0,0 +1,126 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Lorenzo Leone <lleone@iis.ee.ethz.ch>
+
+// Trace ring buffer test. Every cluster runs a kernel that emits a short sequence
+// of events, then cluster 0 emits more events than its ring holds. The kernels are
+// offloaded with the plain offload calls, which record dispatch and collect events,
+// while the bootrom records start and return. The host drains the rings and checks
+// order, contents and the count of overwritten events.
+
+#include "offload.h"
+#include "soc_addr_map.h"
+#include "trace.h"
+#include <regs/soc_ctrl.h>
+#include <stdint.h>
+
+#define NUM_EVENTS 8
+#define NUM_FLOOD_EVENTS (TRACE_RING_ENTRIES + 40)
+#define TESTVAL 0x7AC0
+
+static traceRecord_t records[TRACE_NUM_RINGS * TRACE_RING_ENTRIES];
+
+int32_t eventKernel() {
+    for (uint32_t i = 0; i < NUM_EVENTS; i++) {
+        traceEvent(TRACE_EV_USER + i, i);
+    }
+    return TESTVAL;
+}
+
+int32_t floodKernel() {
+    for (uint32_t i = 0; i < NUM_FLOOD_EVENTS; i++) {
+        traceEvent(TRACE_EV_USER, i);
+    }
+    return TESTVAL;
+}
+
+/* Checks the events of one cluster ring: start, the kernel's events, return */
+static int checkClusterRing(traceRecord_t *rec, uint32_t count, uint8_t ring) {
+    uint32_t n = 0;
+    uint32_t lastTimestamp = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (rec[i].ring != ring) continue;
+
+        if (n > 0 && rec[i].timestamp < lastTimestamp) return 1;
+        lastTimestamp = rec[i].timestamp;
+
+        if (n == 0) {
+            if (rec[i].event != TRACE_EV_START || rec[i].arg != (uint32_t)eventKernel) return 1;
+        } else if (n <= NUM_EVENTS) {
+            if (rec[i].event != TRACE_EV_USER + n - 1 || rec[i].arg != n - 1) return 1;
+        } else if (rec[i].event != TRACE_EV_RETURN || rec[i].arg != TESTVAL) {
+            return 1;
+        }
+        if (rec[i].seq != n) return 1;
+        n++;
+    }
+
+    return n != NUM_EVENTS + 2;
+}
+
+int main() {
+    volatile uint8_t *regPtr = (volatile uint8_t *)SOC_CTRL_BASE;
+    setupInterruptHandler(clearSoftInterrupt);
+    traceInit();
+
+    for (int i = 0; i < _chimera_numClusters; i++) {
+        setClusterReset(regPtr, i, 0);
+        setClusterClockGating(regPtr, i, 0);
+    }
+
+    for (int i = 0; i < _chimera_numClusters; i++) {
+        offloadToCluster(eventKernel, i);
+    }
+    for (int i = 0; i < _chimera_numClusters; i++) {
+        if (waitForCluster(i) != (TESTVAL | 1)) return 1;
+    }
+
+    uint32_t count = traceDrain(records, sizeof(records) / sizeof(records[0]));
+    if (count != _chimera_numClusters * (NUM_EVENTS + 2) + 2 * _chimera_numClusters) {
+        return 2;
+    }
+
+    for (int i = 0; i < _chimera_numClusters; i++) {
+        if (checkClusterRing(records, count, i)) return 3 + i;
+    }
+
+    // The host ring holds all dispatches followed by all collections
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (records[i].ring != TRACE_HOST_RING) continue;
+        uint16_t expected = n < _chimera_numClusters ? TRACE_EV_DISPATCH : TRACE_EV_COLLECT;
+        if (records[i].event != expected || records[i].arg != n % _chimera_numClusters ||
+            records[i].hart != 0) {
+            return 8;
+        }
+        n++;
+    }
+
+    // Overflow: only the newest TRACE_RING_ENTRIES events of cluster 0 survive
+    offloadToCluster(floodKernel, 0);
+    if (waitForCluster(0) != (TESTVAL | 1)) return 9;
+
+    count = traceDrain(records, sizeof(records) / sizeof(records[0]));
+    uint32_t drained = 0;
+    uint32_t lastArg = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (records[i].ring != 0 || records[i].event != TRACE_EV_USER) continue;
+        if (drained > 0 && records[i].arg != lastArg + 1) return 10;
+        lastArg = records[i].arg;
+        drained++;
+    }
+    // The return event takes one of the surviving entries, the start event is lost
+    if (drained != TRACE_RING_ENTRIES - 1 || lastArg != NUM_FLOOD_EVENTS - 1) {
+        return 11;
+    }
+    if (traceLost(0) != NUM_FLOOD_EVENTS + 2 - TRACE_RING_ENTRIES) {
+        return 12;
+    }
+
+    setAllClusterClockGating(regPtr, 1);
+
+    return 0;
+}
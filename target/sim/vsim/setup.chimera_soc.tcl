@@ -5,4 +5,9 @@
 # Moritz Scherer <scheremo@iis.ee.ethz.ch>
 
 set BINARY ../../../sw/tests/testCluster.memisl.elf
-set SELCFG 0
+# Chimera configuration (chimera_pkg::ChimeraCfg index), overridable from the environment
+if {[info exists ::env(SELCFG)]} {
+    set SELCFG $::env(SELCFG)
+} else {
+    set SELCFG 0
+}